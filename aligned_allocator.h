@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// Аллокатор с гарантированным выравниванием буфера. Выравнивание на 64 байта
+// (кэш-линия) по умолчанию позволяет SIMD-ядрам использовать выровненные
+// загрузки от GetAddress() без проверок
+template <typename T, size_t Alignment = 64>
+struct AlignedAllocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Выравнивание должно быть степенью двойки");
+    static_assert(Alignment >= alignof(T), "Выравнивание не может быть меньше alignof(T)");
+
+    T* Allocate(size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+
+        return static_cast<T*>(operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept
+    {
+        operator delete(buf, std::align_val_t{ Alignment });
+    }
+};
+
+// Порог, начиная с которого буфер выделяется отдельным mmap-ом с просьбой
+// о прозрачных больших страницах: меньше промахов dTLB на сканах больших
+// векторов. Совпадает с размером huge page на x86-64
+inline constexpr size_t HUGE_PAGE_THRESHOLD = 2 * 1024 * 1024;
+
+// Аллокатор с поддержкой больших страниц (только Linux; на остальных
+// платформах ведёт себя как обычный operator new). Буферы меньше порога
+// идут через кучу — большие страницы для них не окупаются
+template <typename T>
+struct HugePageAllocator
+{
+    T* Allocate(size_t n)
+    {
+        const size_t bytes = n * sizeof(T);
+        if (n == 0)
+            return nullptr;
+
+#if defined(__linux__)
+        if (bytes >= HUGE_PAGE_THRESHOLD)
+        {
+            void* page = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (page == MAP_FAILED)
+                throw std::bad_alloc();
+
+            madvise(page, bytes, MADV_HUGEPAGE);
+            return static_cast<T*>(page);
+        }
+#endif
+        return static_cast<T*>(operator new(bytes));
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept
+    {
+        if (buf == nullptr)
+            return;
+
+#if defined(__linux__)
+        if (n * sizeof(T) >= HUGE_PAGE_THRESHOLD)
+        {
+            munmap(buf, n * sizeof(T));
+            return;
+        }
+#endif
+        operator delete(buf);
+    }
+};
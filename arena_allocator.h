@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+// Монотонная арена: выделяет из заранее зарезервированного блока простым
+// смещением указателя, память возвращается только целиком через Reset.
+// Удобна для векторов со временем жизни в пределах одного запроса
+class ArenaResource
+{
+public:
+    explicit ArenaResource(size_t bytes)
+        : buffer_(bytes != 0 ? static_cast<unsigned char*>(operator new(bytes)) : nullptr)
+        , size_(bytes)
+    {
+    }
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+
+    ~ArenaResource()
+    {
+        operator delete(buffer_);
+    }
+
+    void* Allocate(size_t bytes, size_t alignment)
+    {
+        size_t offset = (used_ + alignment - 1) / alignment * alignment;
+        if (offset + bytes > size_)
+            throw std::bad_alloc();
+
+        used_ = offset + bytes;
+        return buffer_ + offset;
+    }
+
+    // Сбрасывает арену: вся ранее выделенная память считается свободной.
+    // Вектора, живущие на арене, к этому моменту должны быть разрушены
+    void Reset() noexcept
+    {
+        used_ = 0;
+    }
+
+    size_t Used() const noexcept
+    {
+        return used_;
+    }
+
+private:
+    unsigned char* buffer_ = nullptr;
+    size_t size_ = 0;
+    size_t used_ = 0;
+};
+
+// Аллокатор для RawMemory/Vector поверх ArenaResource. Deallocate ничего
+// не делает: освобождение — это Reset арены целиком
+template <typename T>
+class ArenaAllocator
+{
+public:
+    explicit ArenaAllocator(ArenaResource& arena) noexcept
+        : arena_(&arena)
+    {
+    }
+
+    T* Allocate(size_t n)
+    {
+        return n != 0 ? static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T))) : nullptr;
+    }
+
+    void Deallocate(T* /*buf*/, size_t /*n*/) noexcept
+    {
+    }
+
+private:
+    ArenaResource* arena_;
+};
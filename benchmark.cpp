@@ -0,0 +1,160 @@
+// Бенчмарк операций Vector против std::vector.
+// Собирается отдельной целью от тестов:
+//     g++ -std=c++20 -O2 -DNDEBUG -o benchmark benchmark.cpp
+// Размер самого большого прогона можно передать первым аргументом
+// (по умолчанию 10M элементов, чтобы прогон укладывался в секунды)
+
+#include "vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double MeasureMs(auto&& body)
+    {
+        const auto start = Clock::now();
+        body();
+        const auto finish = Clock::now();
+        return std::chrono::duration<double, std::milli>(finish - start).count();
+    }
+
+    void PrintRow(const std::string& name, size_t n, double ours_ms, double std_ms)
+    {
+        std::cout << std::left << std::setw(34) << name
+                  << std::right << std::setw(12) << n
+                  << std::setw(12) << std::fixed << std::setprecision(2) << ours_ms
+                  << std::setw(12) << std_ms
+                  << std::setw(9) << std::setprecision(2) << (std_ms / (ours_ms > 0 ? ours_ms : 1e-9)) << 'x'
+                  << '\n';
+    }
+
+    // Нетривиальный элемент: перемещение дешёвое, копирование дорогое
+    struct Heavy
+    {
+        Heavy() = default;
+        explicit Heavy(int id) : payload(64, static_cast<char>('a' + id % 26)) {}
+        std::string payload;
+    };
+
+    template <typename V>
+    void PushBackN(V& v, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            if constexpr (requires { v.PushBack(0); })
+                v.PushBack(static_cast<int>(i));
+            else
+                v.push_back(static_cast<int>(i));
+        }
+    }
+
+    void BenchPushBackGrowth(size_t max_n)
+    {
+        for (size_t n : { size_t(1'000), size_t(1'000'000), max_n })
+        {
+            double ours = MeasureMs([n] { Vector<int> v; PushBackN(v, n); });
+            double base = MeasureMs([n] { std::vector<int> v; PushBackN(v, n); });
+            PrintRow("PushBack<int> growth", n, ours, base);
+        }
+    }
+
+    void BenchReserve(size_t n)
+    {
+        double ours = MeasureMs([n] { Vector<int> v; v.Reserve(n); });
+        double base = MeasureMs([n] { std::vector<int> v; v.reserve(n); });
+        PrintRow("Reserve<int>", n, ours, base);
+    }
+
+    void BenchResize(size_t n)
+    {
+        double ours = MeasureMs([n] { Vector<int> v; v.Resize(n); });
+        double base = MeasureMs([n] { std::vector<int> v; v.resize(n); });
+        PrintRow("Resize<int>", n, ours, base);
+    }
+
+    void BenchReallocHeavy(size_t n)
+    {
+        double ours = MeasureMs([n] {
+            Vector<Heavy> v;
+            for (size_t i = 0; i < n; ++i)
+                v.EmplaceBack(static_cast<int>(i));
+        });
+        double base = MeasureMs([n] {
+            std::vector<Heavy> v;
+            for (size_t i = 0; i < n; ++i)
+                v.emplace_back(static_cast<int>(i));
+        });
+        PrintRow("EmplaceBack<Heavy> growth", n, ours, base);
+    }
+
+    void BenchMidEmplaceErase(size_t n, size_t ops)
+    {
+        double ours = MeasureMs([n, ops] {
+            Vector<int> v;
+            v.Resize(n);
+            for (size_t i = 0; i < ops; ++i)
+                v.Emplace(v.cbegin() + n / 2, static_cast<int>(i));
+            for (size_t i = 0; i < ops; ++i)
+                v.Erase(v.cbegin() + n / 2);
+        });
+        double base = MeasureMs([n, ops] {
+            std::vector<int> v;
+            v.resize(n);
+            for (size_t i = 0; i < ops; ++i)
+                v.emplace(v.cbegin() + n / 2, static_cast<int>(i));
+            for (size_t i = 0; i < ops; ++i)
+                v.erase(v.cbegin() + n / 2);
+        });
+        PrintRow("mid Emplace+Erase<int>", n, ours, base);
+    }
+
+    void BenchCopyAssign(size_t n)
+    {
+        Vector<int> src_ours;
+        src_ours.Resize(n);
+        std::vector<int> src_base(n);
+
+        double ours = MeasureMs([&] { Vector<int> dst; dst = src_ours; });
+        double base = MeasureMs([&] { std::vector<int> dst; dst = src_base; });
+        PrintRow("copy-assign<int>", n, ours, base);
+
+        Vector<Heavy> hsrc_ours;
+        std::vector<Heavy> hsrc_base;
+        for (size_t i = 0; i < n / 100; ++i)
+        {
+            hsrc_ours.EmplaceBack(static_cast<int>(i));
+            hsrc_base.emplace_back(static_cast<int>(i));
+        }
+        double hours = MeasureMs([&] { Vector<Heavy> dst; dst = hsrc_ours; });
+        double hbase = MeasureMs([&] { std::vector<Heavy> dst; dst = hsrc_base; });
+        PrintRow("copy-assign<Heavy>", n / 100, hours, hbase);
+    }
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t max_n = 10'000'000;
+    if (argc > 1)
+        max_n = std::stoull(argv[1]);
+
+    std::cout << std::left << std::setw(34) << "operation"
+              << std::right << std::setw(12) << "N"
+              << std::setw(12) << "Vector,ms"
+              << std::setw(12) << "std,ms"
+              << std::setw(10) << "speedup" << '\n';
+
+    BenchPushBackGrowth(max_n);
+    BenchReserve(max_n);
+    BenchResize(max_n);
+    BenchReallocHeavy(max_n / 100);
+    BenchMidEmplaceErase(100'000, 1'000);
+    BenchCopyAssign(max_n);
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "vector.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+// Упакованный битовый вектор: 64 флага на слово вместо байта на флаг.
+// Восьмикратный выигрыш по памяти и пропускной способности на битовых
+// масках, а межмасочные операции (And/Or/AndNot) и подсчёт единиц идут
+// по слову за такт. Инвариант: биты выше size_ в последнем слове — нули,
+// поэтому Count и пословные операции не требуют маскировки хвоста
+class BitVector
+{
+    static constexpr size_t BITS_PER_WORD = 64;
+
+public:
+    BitVector() = default;
+
+    explicit BitVector(size_t size)
+    {
+        Resize(size);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return words_.Capacity() * BITS_PER_WORD;
+    }
+
+    bool operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return (words_[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1u;
+    }
+
+    bool Test(size_t index) const noexcept
+    {
+        return (*this)[index];
+    }
+
+    void Set(size_t index, bool value = true) noexcept
+    {
+        assert(index < size_);
+        const uint64_t bit = uint64_t{ 1 } << (index % BITS_PER_WORD);
+        if (value)
+            words_[index / BITS_PER_WORD] |= bit;
+        else
+            words_[index / BITS_PER_WORD] &= ~bit;
+    }
+
+    void Reset(size_t index) noexcept
+    {
+        Set(index, false);
+    }
+
+    void PushBack(bool value)
+    {
+        if (size_ % BITS_PER_WORD == 0)
+            words_.PushBack(uint64_t{ 0 });
+
+        ++size_;
+        if (value)
+            Set(size_ - 1);
+    }
+
+    // Дозапись сразу пачки битов: bits младших битов слова word.
+    // В 64 раза меньше итераций, чем побитовый PushBack
+    void PushBackWord(uint64_t word, size_t bits = BITS_PER_WORD)
+    {
+        assert(bits <= BITS_PER_WORD);
+        if (bits == 0)
+            return;
+
+        if (bits != BITS_PER_WORD)
+            word &= (uint64_t{ 1 } << bits) - 1;
+
+        const size_t offset = size_ % BITS_PER_WORD;
+        if (offset == 0)
+        {
+            words_.PushBack(word);
+        }
+        else
+        {
+            // Младшая часть доливается в хвостовое слово,
+            // остаток уходит в новое
+            words_[words_.Size() - 1] |= word << offset;
+            if (bits > BITS_PER_WORD - offset)
+                words_.PushBack(word >> (BITS_PER_WORD - offset));
+        }
+        size_ += bits;
+    }
+
+    void Resize(size_t new_size)
+    {
+        words_.Resize((new_size + BITS_PER_WORD - 1) / BITS_PER_WORD);
+        size_ = new_size;
+        ClearTail();
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        words_.Reserve((new_capacity + BITS_PER_WORD - 1) / BITS_PER_WORD);
+    }
+
+    // Массовая установка диапазона [from, to): крайние слова — масками,
+    // середина — записью целых слов
+    void SetRange(size_t from, size_t to) noexcept
+    {
+        ApplyRange(from, to, true);
+    }
+
+    void ResetRange(size_t from, size_t to) noexcept
+    {
+        ApplyRange(from, to, false);
+    }
+
+    // Число выставленных битов — popcount по словам
+    size_t Count() const noexcept
+    {
+        size_t total = 0;
+        for (size_t i = 0; i != words_.Size(); ++i)
+            total += static_cast<size_t>(std::popcount(words_[i]));
+        return total;
+    }
+
+    // Пословные операции между масками одинаковой длины
+
+    void And(const BitVector& other) noexcept
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i != words_.Size(); ++i)
+            words_[i] &= other.words_[i];
+    }
+
+    void Or(const BitVector& other) noexcept
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i != words_.Size(); ++i)
+            words_[i] |= other.words_[i];
+    }
+
+    // this &= ~other — вычитание маски
+    void AndNot(const BitVector& other) noexcept
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i != words_.Size(); ++i)
+            words_[i] &= ~other.words_[i];
+    }
+
+    bool operator==(const BitVector& rhs) const
+    {
+        return size_ == rhs.size_ && words_ == rhs.words_;
+    }
+
+    void Swap(BitVector& other) noexcept
+    {
+        words_.Swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    void ApplyRange(size_t from, size_t to, bool value) noexcept
+    {
+        assert(from <= to && to <= size_);
+        if (from == to)
+            return;
+
+        const size_t first_word = from / BITS_PER_WORD;
+        const size_t last_word = (to - 1) / BITS_PER_WORD;
+
+        // Маска битов [begin_bit, end_bit) внутри одного слова
+        auto word_mask = [](size_t begin_bit, size_t end_bit) noexcept
+        {
+            const uint64_t high = end_bit == BITS_PER_WORD
+                ? ~uint64_t{ 0 } : (uint64_t{ 1 } << end_bit) - 1;
+            return high & ~((uint64_t{ 1 } << begin_bit) - 1);
+        };
+
+        for (size_t w = first_word; w <= last_word; ++w)
+        {
+            const size_t begin_bit = w == first_word ? from % BITS_PER_WORD : 0;
+            const size_t end_bit = w == last_word
+                ? (to - 1) % BITS_PER_WORD + 1 : BITS_PER_WORD;
+            const uint64_t mask = word_mask(begin_bit, end_bit);
+            if (value)
+                words_[w] |= mask;
+            else
+                words_[w] &= ~mask;
+        }
+    }
+
+    // Зануляет биты выше size_ в последнем слове
+    void ClearTail() noexcept
+    {
+        const size_t offset = size_ % BITS_PER_WORD;
+        if (offset != 0 && !words_.Empty())
+            words_[words_.Size() - 1] &= (uint64_t{ 1 } << offset) - 1;
+    }
+
+private:
+    Vector<uint64_t> words_;
+    size_t size_ = 0;
+};
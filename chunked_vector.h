@@ -0,0 +1,285 @@
+#pragma once
+
+#include "vector.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Вектор на сегментированном хранилище: элементы лежат в стабильных
+// сегментах фиксированного размера (по умолчанию 2 МБ), а растёт только
+// маленький индексный блок с их адресами. Дозапись никогда не переносит
+// существующие элементы, поэтому нет ни многосекундных пиков на
+// реаллокации миллиардного буфера, ни удвоения RSS, пока старый и новый
+// буферы живут одновременно. Плата — потеря сплошного размещения:
+// доступ по индексу стоит деление на ёмкость сегмента
+template <typename T, size_t SegmentBytes = 2 * 1024 * 1024>
+class ChunkedVector
+{
+    // Ёмкость сегмента округляется вниз до степени двойки,
+    // чтобы деление и остаток сводились к сдвигу и маске
+    static constexpr size_t SEGMENT_CAPACITY =
+        sizeof(T) >= SegmentBytes ? 1 : std::bit_floor(SegmentBytes / sizeof(T));
+
+    // Один итератор на обе константности, чтобы не дублировать арифметику
+    template <bool IsConst>
+    class BasicIterator
+    {
+        friend class ChunkedVector;
+        using Owner = std::conditional_t<IsConst, const ChunkedVector, ChunkedVector>;
+
+        BasicIterator(Owner* owner, size_t pos) noexcept
+            : owner_(owner)
+            , pos_(pos)
+        {
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        BasicIterator() = default;
+        BasicIterator(const BasicIterator&) = default;
+        BasicIterator& operator=(const BasicIterator&) = default;
+
+        // Неявное превращение iterator -> const_iterator
+        BasicIterator(const BasicIterator<false>& other) noexcept requires IsConst
+            : owner_(other.owner_)
+            , pos_(other.pos_)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return (*owner_)[pos_];
+        }
+
+        pointer operator->() const noexcept
+        {
+            return &**this;
+        }
+
+        reference operator[](difference_type shift) const noexcept
+        {
+            return (*owner_)[pos_ + shift];
+        }
+
+        BasicIterator& operator++() noexcept { ++pos_; return *this; }
+        BasicIterator operator++(int) noexcept { BasicIterator old(*this); ++pos_; return old; }
+        BasicIterator& operator--() noexcept { --pos_; return *this; }
+        BasicIterator operator--(int) noexcept { BasicIterator old(*this); --pos_; return old; }
+
+        BasicIterator& operator+=(difference_type shift) noexcept { pos_ += shift; return *this; }
+        BasicIterator& operator-=(difference_type shift) noexcept { pos_ -= shift; return *this; }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type shift) noexcept
+        {
+            return it += shift;
+        }
+
+        friend BasicIterator operator+(difference_type shift, BasicIterator it) noexcept
+        {
+            return it += shift;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type shift) noexcept
+        {
+            return it -= shift;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept
+        {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        friend auto operator<=>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept
+        {
+            return lhs.pos_ <=> rhs.pos_;
+        }
+
+    private:
+        Owner* owner_ = nullptr;
+        size_t pos_ = 0;
+    };
+
+public:
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    ChunkedVector() = default;
+
+    explicit ChunkedVector(size_t size)
+    {
+        Resize(size);
+    }
+
+    ChunkedVector(const ChunkedVector& other)
+    {
+        Reserve(other.size_);
+        for (const T& value : other)
+            PushBack(value);
+    }
+
+    ChunkedVector(ChunkedVector&& other) noexcept
+    {
+        Swap(other);
+    }
+
+    ChunkedVector& operator=(const ChunkedVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            ChunkedVector copy(rhs);
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    ChunkedVector& operator=(ChunkedVector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            ChunkedVector moved(std::move(rhs));
+            Swap(moved);
+        }
+        return *this;
+    }
+
+    ~ChunkedVector()
+    {
+        DestroyTail(0);
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<ChunkedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return segments_[index / SEGMENT_CAPACITY][index % SEGMENT_CAPACITY];
+    }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return segments_.Size() * SEGMENT_CAPACITY;
+    }
+
+    bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    static constexpr size_t SegmentCapacity() noexcept
+    {
+        return SEGMENT_CAPACITY;
+    }
+
+    // Донавешивает сегменты; существующие элементы остаются на месте
+    void Reserve(size_t new_capacity)
+    {
+        while (Capacity() < new_capacity)
+            segments_.EmplaceBack(SEGMENT_CAPACITY);
+    }
+
+    void Resize(size_t new_size)
+    {
+        if (new_size < size_)
+        {
+            DestroyTail(new_size);
+            size_ = new_size;
+            return;
+        }
+
+        Reserve(new_size);
+        while (size_ < new_size)
+        {
+            const size_t room = SEGMENT_CAPACITY - size_ % SEGMENT_CAPACITY;
+            const size_t run = std::min(new_size - size_, room);
+            ValueConstructRange(SlotAddress(size_), run);
+            size_ += run;
+        }
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (size_ == Capacity())
+            segments_.EmplaceBack(SEGMENT_CAPACITY);
+
+        T* slot = SlotAddress(size_);
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    template <class Value>
+    void PushBack(Value&& value)
+    {
+        EmplaceBack(std::forward<Value>(value));
+    }
+
+    // Последний сегмент не освобождается — ёмкость переживает PopBack,
+    // как и у Vector
+    void PopBack() noexcept
+    {
+        assert(!Empty());
+        --size_;
+        std::destroy_at(SlotAddress(size_));
+    }
+
+    void Swap(ChunkedVector& other) noexcept
+    {
+        segments_.Swap(other.segments_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    T* SlotAddress(size_t index) noexcept
+    {
+        return segments_[index / SEGMENT_CAPACITY].GetAddress() + index % SEGMENT_CAPACITY;
+    }
+
+    // Разрушает элементы [from, size_) посегментными пробегами
+    void DestroyTail(size_t from) noexcept
+    {
+        size_t pos = from;
+        while (pos < size_)
+        {
+            const size_t room = SEGMENT_CAPACITY - pos % SEGMENT_CAPACITY;
+            const size_t run = std::min(size_ - pos, room);
+            std::destroy_n(SlotAddress(pos), run);
+            pos += run;
+        }
+    }
+
+private:
+    Vector<RawMemory<T>> segments_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+// Ёмкость одного чанка в элементах. Чанки выделяются лениво при первом
+// обращении, поэтому большой резерв ёмкости не приводит к большому
+// выделению памяти на старте
+inline constexpr size_t CONCURRENT_CHUNK_CAPACITY = 1024;
+
+// Конкурентная витрина дозаписи: много писателей, один читатель.
+// Писатель захватывает слот одним fetch_add по счётчику — без мьютекса
+// и без остановки остальных на реаллокации: буфер растёт чанками,
+// и уже захваченные слоты никогда не переезжают. Готовность слота
+// публикуется отдельным флагом, поэтому читатель может забирать
+// готовый префикс через DrainTo, не дожидаясь отстающих писателей.
+//
+// Порядок элементов между писателями не линеаризуется — важна пропускная
+// способность. Конструктор элемента не должен бросать после захвата
+// слота: его флаг готовности иначе никогда не будет выставлен
+template <typename T>
+class ConcurrentVector
+{
+    struct Chunk
+    {
+        RawMemory<T> memory{ CONCURRENT_CHUNK_CAPACITY };
+        std::atomic<bool> ready[CONCURRENT_CHUNK_CAPACITY]{};
+    };
+
+public:
+    // Ёмкость задаётся заранее и округляется вверх до целого числа чанков;
+    // fetch_add проверяется против неё
+    explicit ConcurrentVector(size_t capacity)
+        : chunk_count_((capacity + CONCURRENT_CHUNK_CAPACITY - 1) / CONCURRENT_CHUNK_CAPACITY)
+        , capacity_(chunk_count_ * CONCURRENT_CHUNK_CAPACITY)
+        , chunks_(new std::atomic<Chunk*>[chunk_count_]())
+    {
+    }
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    ~ConcurrentVector()
+    {
+        const size_t limit = std::min(next_.load(std::memory_order_acquire), capacity_);
+        for (size_t slot = drained_; slot != limit; ++slot)
+        {
+            Chunk* chunk = chunks_[slot / CONCURRENT_CHUNK_CAPACITY].load(std::memory_order_acquire);
+            if (chunk->ready[slot % CONCURRENT_CHUNK_CAPACITY].load(std::memory_order_acquire))
+                std::destroy_at(chunk->memory + slot % CONCURRENT_CHUNK_CAPACITY);
+        }
+
+        for (size_t i = 0; i != chunk_count_; ++i)
+            delete chunks_[i].load(std::memory_order_acquire);
+        delete[] chunks_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // Число завершённых записей; при активных писателях — оценка снизу
+    size_t Size() const noexcept
+    {
+        return committed_.load(std::memory_order_acquire);
+    }
+
+    // Захватывает слот и конструирует элемент на месте.
+    // Возвращает false, если зарезервированная ёмкость исчерпана
+    template <typename... Args>
+    bool TryEmplaceBack(Args&&... args)
+    {
+        const size_t slot = next_.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= capacity_)
+            return false;
+
+        Chunk* chunk = ChunkFor(slot / CONCURRENT_CHUNK_CAPACITY);
+        const size_t offset = slot % CONCURRENT_CHUNK_CAPACITY;
+        std::construct_at(chunk->memory + offset, std::forward<Args>(args)...);
+        chunk->ready[offset].store(true, std::memory_order_release);
+        committed_.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    template <class Value>
+    void PushBack(Value&& value)
+    {
+        if (!TryEmplaceBack(std::forward<Value>(value)))
+            throw std::length_error("ConcurrentVector: зарезервированная ёмкость исчерпана");
+    }
+
+    // Переносит в out готовый префикс накопленного (единственный читатель).
+    // Останавливается на первом слоте, чей писатель ещё не закончил;
+    // остаток заберёт следующий вызов. Возвращает число перенесённых
+    size_t DrainTo(Vector<T>& out)
+    {
+        const size_t limit = std::min(next_.load(std::memory_order_acquire), capacity_);
+        const size_t begin = drained_;
+
+        size_t slot = begin;
+        for (; slot != limit; ++slot)
+        {
+            Chunk* chunk = chunks_[slot / CONCURRENT_CHUNK_CAPACITY].load(std::memory_order_acquire);
+            const size_t offset = slot % CONCURRENT_CHUNK_CAPACITY;
+            if (chunk == nullptr || !chunk->ready[offset].load(std::memory_order_acquire))
+                break;
+
+            T* src = chunk->memory + offset;
+            out.EmplaceBack(std::move(*src));
+            std::destroy_at(src);
+        }
+
+        drained_ = slot;
+        return slot - begin;
+    }
+
+private:
+    // Ленивая публикация чанка: первый писатель, которому он понадобился,
+    // вставляет его через CAS; проигравшие гонку освобождают свой
+    Chunk* ChunkFor(size_t index) noexcept
+    {
+        Chunk* chunk = chunks_[index].load(std::memory_order_acquire);
+        if (chunk == nullptr)
+        {
+            Chunk* fresh = new Chunk();
+            if (chunks_[index].compare_exchange_strong(chunk, fresh,
+                                                       std::memory_order_release,
+                                                       std::memory_order_acquire))
+                chunk = fresh;
+            else
+                delete fresh;
+        }
+        return chunk;
+    }
+
+private:
+    size_t chunk_count_ = 0;
+    size_t capacity_ = 0;
+    std::atomic<Chunk*>* chunks_ = nullptr;
+
+    std::atomic<size_t> next_{ 0 };
+    std::atomic<size_t> committed_{ 0 };
+    size_t drained_ = 0;
+};
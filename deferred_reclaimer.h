@@ -0,0 +1,121 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// Фоновая очередь утилизации: принимает отложенные задачи разрушения
+// и выполняет их в отдельном потоке. Горячий поток отдаёт буфер за O(1)
+// (постановка узла в очередь) вместо синхронного destroy_n по всем
+// элементам. Очередь одна на процесс — как и телеметрия
+class DeferredReclaimer
+{
+    // Узел очереди с виртуальным вызовом вместо std::function:
+    // захваченный буфер перемещаемый, но не копируемый
+    struct Task
+    {
+        Task* next = nullptr;
+
+        virtual ~Task() = default;
+        virtual void Run() = 0;
+    };
+
+    template <typename Fn>
+    struct TaskOf final : Task
+    {
+        Fn fn;
+
+        explicit TaskOf(Fn fn)
+            : fn(std::move(fn))
+        {
+        }
+
+        void Run() override
+        {
+            fn();
+        }
+    };
+
+public:
+    static DeferredReclaimer& Instance()
+    {
+        static DeferredReclaimer reclaimer;
+        return reclaimer;
+    }
+
+    // Ставит задачу в очередь; стоимость — одно выделение узла
+    template <typename Fn>
+    void Defer(Fn fn)
+    {
+        Task* task = new TaskOf<Fn>(std::move(fn));
+        {
+            std::lock_guard lock(mutex_);
+            if (tail_ != nullptr)
+                tail_->next = task;
+            else
+                head_ = task;
+            tail_ = task;
+            ++pending_;
+        }
+        wake_worker_.notify_one();
+    }
+
+    // Дожидается, пока фоновый поток исчерпает очередь, —
+    // для детерминированных тестов и контролируемого завершения
+    void WaitIdle()
+    {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    DeferredReclaimer()
+        : worker_([this] { WorkerLoop(); })
+    {
+    }
+
+    ~DeferredReclaimer()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wake_worker_.notify_one();
+        worker_.join();
+    }
+
+    void WorkerLoop()
+    {
+        std::unique_lock lock(mutex_);
+        while (true)
+        {
+            wake_worker_.wait(lock, [this] { return head_ != nullptr || stopping_; });
+            if (head_ == nullptr && stopping_)
+                return;
+
+            Task* task = head_;
+            head_ = task->next;
+            if (head_ == nullptr)
+                tail_ = nullptr;
+
+            lock.unlock();
+            task->Run();
+            delete task;
+            lock.lock();
+
+            if (--pending_ == 0)
+                idle_.notify_all();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable wake_worker_;
+    std::condition_variable idle_;
+    Task* head_ = nullptr;
+    Task* tail_ = nullptr;
+    size_t pending_ = 0;
+    bool stopping_ = false;
+    std::thread worker_;
+};
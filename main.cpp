@@ -1,6 +1,19 @@
 #include "vector.h"
+#include "aligned_allocator.h"
+#include "bit_vector.h"
+#include "arena_allocator.h"
+#include "chunked_vector.h"
+#include "concurrent_vector.h"
+#include "mapped_vector.h"
+#include "numa_allocator.h"
+#include "shared_vector.h"
+#include "small_vector.h"
+#include "soa_vector.h"
+#include "sorted_vector.h"
 
 #include <iostream>
+#include <sstream>
+#include <atomic>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -564,89 +577,1619 @@ void Test6() {
     }
 }
 
-struct C {
-    C() noexcept {
-        ++def_ctor;
+void Test7() {
+    const size_t SIZE = 10;
+    {
+        Vector<int> v;
+        std::vector<int> src(100'000, 7);
+        v.AppendRange(src.begin(), src.end());
+        assert(v.Size() == src.size());
+        assert(v.Capacity() == src.size());
+        assert(v[0] == 7 && v[src.size() - 1] == 7);
+
+        // Повторное добавление растит ёмкость не более одного раза
+        v.AppendRange(src.begin(), src.begin() + 10);
+        assert(v.Size() == src.size() + 10);
+        assert(v.Capacity() == 2 * src.size());
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v{ SIZE };
+        std::vector<Obj> src;
+        src.emplace_back(1);
+        src.emplace_back(2);
+        auto* pos = v.InsertRange(v.cbegin() + 3, src.begin(), src.end());
+        assert(v.Size() == SIZE + 2);
+        assert(&*pos == &v[3]);
+        assert(v[3].id == 1);
+        assert(v[4].id == 2);
+        assert(Obj::GetAliveObjectCount() == SIZE + 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Вставка в середину без реаллокации: хвост короче и длиннее вставки
+        Vector<int> v;
+        v.Reserve(100);
+        for (int i = 0; i < 10; ++i)
+            v.PushBack(i);
+        const int batch[] = { -1, -2, -3 };
+        v.InsertRange(v.cbegin() + 8, std::begin(batch), std::end(batch));
+        assert(v.Size() == 13);
+        assert(v[7] == 7 && v[8] == -1 && v[10] == -3 && v[11] == 8 && v[12] == 9);
+        v.InsertRange(v.cbegin() + 2, std::begin(batch), std::end(batch));
+        assert(v.Size() == 16);
+        assert(v[1] == 1 && v[2] == -1 && v[4] == -3 && v[5] == 2);
+    }
+    {
+        // Перемещающее добавление через move_iterator
+        Vector<std::string> v;
+        std::vector<std::string> src{ "a", "b" };
+        v.AppendRange(std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+        assert(v.Size() == 2);
+        assert(v[0] == "a" && v[1] == "b");
+        assert(src[0].empty() && src[1].empty());
+    }
+}
+
+void TestCapacityControl() {
+    const size_t SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Resize(10);
+        assert(v.Capacity() == SIZE);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 10);
+        assert(v.Size() == 10);
+        assert(Obj::GetAliveObjectCount() == 10);
+        v.Resize(0);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // ResizeForOverwrite растит размер без зануления содержимого
+        Vector<uint8_t> buf;
+        buf.ResizeForOverwrite(SIZE);
+        assert(buf.Size() == SIZE);
+        assert(buf.Capacity() == SIZE);
+        std::fill(buf.begin(), buf.end(), 0xAB);
+        buf.ResizeForOverwrite(SIZE / 2);
+        assert(buf.Size() == SIZE / 2);
+        assert(buf.Capacity() == SIZE);
+        assert(buf[SIZE / 2 - 1] == 0xAB);
+        buf.ResizeForOverwrite(SIZE);
+        assert(buf.Size() == SIZE);
+    }
+    {
+        // Политика полуторного роста вместо удвоения
+        Vector<int, NewDeleteAllocator<int>, OneAndHalfGrowth> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 100);
+        assert(v.Capacity() < 200);
+        assert(v[99] == 99);
+    }
+}
+
+void TestFastAppend() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            auto& elem = v.UncheckedEmplaceBack(static_cast<int>(i));
+            assert(&elem == &v[i]);
+        }
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        assert(v[SIZE - 1].id == SIZE - 1);
+        assert(Obj::num_moved == 0);
+        assert(Obj::num_copied == 0);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        v.Reserve(2);
+        assert(v.TryPushBack(1));
+        assert(v.TryPushBack(2));
+        assert(!v.TryPushBack(3));
+        assert(v.Size() == 2);
+        assert(v.Capacity() == 2);
+        assert(v[1] == 2);
+    }
+}
+
+namespace {
+
+    // Счётчики атомарные: конструкторы зовутся из нескольких потоков
+    struct ParObj {
+        ParObj() {
+            if (throw_countdown > 0 && throw_countdown.fetch_sub(1) == 1) {
+                throw std::runtime_error("Oops");
+            }
+            ++alive;
+        }
+        ~ParObj() {
+            --alive;
+        }
+
+        static inline std::atomic<int> alive = 0;
+        static inline std::atomic<int> throw_countdown = 0;
+    };
+
+}  // namespace
+
+void TestParallelInit() {
+    const size_t SIZE = 1'000'000;
+    {
+        Vector<ParObj> v(SIZE, std::execution::par);
+        assert(v.Size() == SIZE);
+        assert(ParObj::alive == static_cast<int>(SIZE));
+
+        v.Resize(SIZE / 4, std::execution::par);
+        assert(v.Size() == SIZE / 4);
+        assert(ParObj::alive == static_cast<int>(SIZE / 4));
+
+        v.Resize(SIZE / 2, std::execution::par);
+        assert(v.Size() == SIZE / 2);
+        assert(ParObj::alive == static_cast<int>(SIZE / 2));
+    }
+    assert(ParObj::alive == 0);
+    {
+        // Исключение в одном из потоков не должно терять уже построенные элементы
+        ParObj::throw_countdown = static_cast<int>(SIZE / 2);
+        try {
+            Vector<ParObj> v(SIZE, std::execution::par);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(ParObj::alive == 0);
+        ParObj::throw_countdown = 0;
+    }
+    {
+        // Параллельный Resize заполняет новые элементы так же, как обычный
+        Vector<int> v;
+        v.Resize(SIZE, std::execution::par);
+        assert(v.Size() == SIZE);
+        assert(v[0] == 0 && v[SIZE - 1] == 0);
+    }
+}
+
+void TestBulkErase() {
+    const size_t SIZE = 10;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (size_t i = 0; i < SIZE; ++i)
+            v.EmplaceBack(static_cast<int>(i));
+
+        auto* pos = v.Erase(v.cbegin() + 2, v.cbegin() + 5);
+        assert(v.Size() == SIZE - 3);
+        assert((pos - v.begin()) == 2);
+        assert(v[1].id == 1);
+        assert(v[2].id == 5);
+        assert(v[6].id == 9);
+        assert(Obj::GetAliveObjectCount() == SIZE - 3);
+
+        // Пустой диапазон ничего не меняет
+        v.Erase(v.cbegin() + 1, v.cbegin() + 1);
+        assert(v.Size() == SIZE - 3);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        for (int i = 0; i < 100; ++i)
+            v.PushBack(i);
+        const size_t removed = v.RemoveIf([](int x) { return x % 2 == 0; });
+        assert(removed == 50);
+        assert(v.Size() == 50);
+        assert(v[0] == 1 && v[49] == 99);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (size_t i = 0; i < SIZE; ++i)
+            v.EmplaceBack(static_cast<int>(i));
+
+        auto* pos = v.UnorderedErase(v.cbegin() + 1);
+        assert(v.Size() == SIZE - 1);
+        assert(pos->id == SIZE - 1);
+        assert(v[0].id == 0);
+
+        // Удаление последнего элемента не должно самоприсваиваться
+        v.UnorderedErase(v.cbegin() + v.Size() - 1);
+        assert(v.Size() == SIZE - 2);
+        assert(Obj::GetAliveObjectCount() == SIZE - 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+namespace {
+
+    // Таблица, собранная Vector-ом целиком на этапе компиляции
+    constexpr uint32_t ConstexprTableSum() {
+        Vector<uint32_t> v;
+        for (uint32_t i = 0; i < 16; ++i) {
+            v.PushBack(i * i);
+        }
+        v.Emplace(v.cbegin(), 100u);
+        v.Erase(v.cbegin() + 1);
+        v.Resize(20);
+        v.ShrinkToFit();
+
+        uint32_t sum = 0;
+        for (uint32_t x : v) {
+            sum += x;
+        }
+        return sum;
+    }
+
+    constexpr size_t ConstexprCopyAssign() {
+        Vector<int> a(5);
+        Vector<int> b;
+        b.AppendRange(a.begin(), a.end());
+        b.InsertRange(b.cbegin() + 2, a.begin(), a.begin() + 3);
+        Vector<int> c;
+        c = b;
+        c.RemoveIf([](int x) { return x == 0; });
+        return b.Size() * 100 + c.Size();
+    }
+
+    // Сравнение работает и в constant evaluation — минуя memcmp-путь
+    constexpr bool ConstexprCompare() {
+        Vector<int> a(3);
+        Vector<int> b(3);
+        const bool equal = a == b;
+        b[2] = 1;
+        return equal && a < b;
+    }
+
+    static_assert(ConstexprTableSum() == 1340);
+    static_assert(ConstexprCopyAssign() == 800);
+    static_assert(ConstexprCompare());
+
+}  // namespace
+
+void TestAlignedAndHugePages() {
+    {
+        Vector<float, AlignedAllocator<float>> v;
+        v.Resize(1000);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        v.PushBack(1.0f);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 64 == 0);
+        assert(v[1000] == 1.0f);
+    }
+    {
+        Vector<double, AlignedAllocator<double, 32>> v(10);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % 32 == 0);
+    }
+    {
+        // Буфер за порогом больших страниц: обычная работа и освобождение
+        Vector<int, HugePageAllocator<int>> v;
+        v.Resize(HUGE_PAGE_THRESHOLD / sizeof(int) + 100);
+        v[0] = 1;
+        v[v.Size() - 1] = 2;
+        assert(v[0] == 1 && v[v.Size() - 1] == 2);
+        v.Resize(10);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 10);
+    }
+}
+
+void TestMappedVector() {
+    const char* path = "test_mapped_vector.bin";
+    ::unlink(path);
+    {
+        MappedVector<int> v(path);
+        assert(v.Empty());
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 1000);
+        assert(v[999] == 999);
+        v.Flush();
+    }
+    {
+        // Повторное открытие видит записанные элементы без чтения файла
+        MappedVector<int> v(path);
+        assert(v.Size() == 1000);
+        assert(v[0] == 0 && v[500] == 500 && v[999] == 999);
+        v.PopBack();
+        v.PopBack();
+        assert(v.Size() == 998);
+    }
+    {
+        // Файл обрезан до фактического размера при разрушении
+        MappedVector<int> v(path);
+        assert(v.Size() == 998);
+        v.Resize(2000);
+        assert(v.Size() == 2000);
+        assert(v[1999] == 0);
+    }
+    ::unlink(path);
+}
+
+void TestArenaAllocator() {
+    ArenaResource arena(1024 * 1024);
+    {
+        Vector<int, ArenaAllocator<int>> v(ArenaAllocator<int>{ arena });
+        v.Reserve(100);
+        assert(arena.Used() >= 100 * sizeof(int));
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 1000);
+        assert(v[999] == 999);
+
+        // Копия наследует аллокатор источника и тоже живёт на арене
+        const size_t used_before_copy = arena.Used();
+        auto v_copy(v);
+        assert(arena.Used() >= used_before_copy + 1000 * sizeof(int));
+        assert(v_copy[500] == 500);
+    }
+    arena.Reset();
+    assert(arena.Used() == 0);
+    {
+        // Арена меньше запроса должна бросить bad_alloc
+        ArenaResource tiny(16);
+        Vector<int, ArenaAllocator<int>> v(ArenaAllocator<int>{ tiny });
+        try {
+            v.Reserve(1000);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::bad_alloc&) {
+        }
+        assert(v.Capacity() == 0);
+    }
+}
+
+void TestSmallVector() {
+    const size_t INLINE = 8;
+    {
+        // Пока элементов не больше INLINE, куча не используется
+        SmallVector<int, INLINE> v;
+        assert(v.Capacity() == INLINE);
+        for (int i = 0; i < static_cast<int>(INLINE); ++i) {
+            v.PushBack(i);
+        }
+        assert(!v.Spilled());
+        assert(v.Size() == INLINE);
+        assert(v[3] == 3);
+
+        // Девятый элемент вытесняет содержимое в кучу
+        v.PushBack(42);
+        assert(v.Spilled());
+        assert(v.Size() == INLINE + 1);
+        assert(v[3] == 3);
+        assert(v[INLINE] == 42);
+    }
+    {
+        Obj::ResetCounters();
+        SmallVector<Obj, INLINE> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        assert(!v.Spilled());
+        assert(Obj::GetAliveObjectCount() == 2);
+
+        SmallVector<Obj, INLINE> moved(std::move(v));
+        assert(moved.Size() == 2);
+        assert(moved[1].id == 2);
+        assert(Obj::GetAliveObjectCount() == 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        SmallVector<Obj, 2> v;
+        v.EmplaceBack(1);
+        v.Insert(v.cbegin(), Obj{ 0 });
+        v.Emplace(v.cbegin() + 1, 7);
+        assert(v.Spilled());
+        assert(v.Size() == 3);
+        assert(v[0].id == 0);
+        assert(v[1].id == 7);
+        assert(v[2].id == 1);
+        v.Erase(v.cbegin() + 1);
+        assert(v.Size() == 2);
+        assert(v[1].id == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        SmallVector<std::string, 2> v;
+        v.PushBack("a");
+        v.PushBack("b");
+        SmallVector<std::string, 2> v_copy(v);
+        v_copy.PushBack("c");
+        v = v_copy;
+        assert(v.Size() == 3);
+        assert(v[2] == "c");
+        v.Resize(1);
+        assert(v.Size() == 1);
+        assert(v[0] == "a");
+    }
+}
+
+void TestSimdAlgorithms() {
+    {
+        Vector<int> v(100);
+        v.Fill(7);
+        assert(v[0] == 7 && v[63] == 7 && v[99] == 7);
+
+        v[77] = -1;
+        assert(v.Find(-1) == v.begin() + 77);
+        assert(v.Find(123) == v.end());
+
+        // 99 семёрок и одна -1
+        assert(v.Sum() == 7 * 99 - 1);
+        auto [mn, mx] = v.MinMax();
+        assert(mn == -1);
+        assert(mx == 7);
+        assert(v.CountIf([](int x) { return x > 0; }) == 99);
+    }
+    {
+        // Длина не кратна ширине SIMD-регистра: проверяем скалярный хвост
+        Vector<float> v;
+        for (int i = 0; i < 19; ++i) {
+            v.PushBack(static_cast<float>(i));
+        }
+        assert(v.Sum() == 171.0f);
+        auto [mn, mx] = v.MinMax();
+        assert(mn == 0.0f);
+        assert(mx == 18.0f);
+        assert(v.Find(18.0f) == v.end() - 1);
+    }
+    {
+        // Однобайтовый тип идёт через memchr
+        Vector<char> v;
+        for (char c = 'a'; c <= 'z'; ++c) {
+            v.PushBack(c);
+        }
+        assert(v.Find('q') == v.begin() + ('q' - 'a'));
+        assert(v.Find('!') == v.end());
+    }
+    {
+        // Нетривиальный тип: работает общая ветка на std::find
+        Vector<std::string> v;
+        v.PushBack("alpha");
+        v.PushBack("beta");
+        assert(v.Find("beta") == v.begin() + 1);
+        assert(v.CountIf([](const std::string& s) { return s.size() == 5; }) == 1);
+    }
+}
+
+void TestSharedVector() {
+    {
+        SharedVector<int> writer(1000);
+        for (size_t i = 0; i < writer.Size(); ++i) {
+            writer[i] = static_cast<int>(i);
+        }
+
+        // Снимок — это O(1): общий буфер, никакого копирования элементов
+        SharedVector<int> snapshot(writer);
+        assert(snapshot.Shared() && writer.Shared());
+        assert(writer.UseCount() == 2);
+        assert(snapshot.cbegin() == writer.cbegin());
+
+        // Первая мутация писателя переезжает в приватный буфер;
+        // снимок остаётся на старом
+        writer.PushBack(1000);
+        assert(!writer.Shared());
+        assert(!snapshot.Shared());
+        assert(snapshot.cbegin() != writer.cbegin());
+        assert(writer.Size() == 1001);
+        assert(snapshot.Size() == 1000);
+        assert(snapshot[999] == 999);
+        assert(writer[1000] == 1000);
+
+        // Дальнейшие дописывания идут без переездов до исчерпания ёмкости
+        const int* before = writer.cbegin();
+        writer.PushBack(1001);
+        assert(writer.cbegin() == before);
+    }
+    {
+        // Запись по индексу при живой копии тоже отцепляет буфер
+        SharedVector<int> a(10);
+        SharedVector<int> b(a);
+        b[5] = 42;
+        assert(a[5] == 0);
+        assert(b[5] == 42);
+        assert(a.UseCount() == 1 && b.UseCount() == 1);
+    }
+    {
+        Obj::ResetCounters();
+        SharedVector<Obj> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        {
+            SharedVector<Obj> copy(v);
+            const int copies_before = Obj::num_copied;
+            SharedVector<Obj> another(copy);
+            assert(Obj::num_copied == copies_before);
+            assert(v.UseCount() == 3);
+            assert(Obj::GetAliveObjectCount() == 2);
+
+            // Отцепление копирует элементы — снимки владеют исходными
+            copy.EmplaceBack(3);
+            assert(Obj::num_copied == copies_before + 2);
+            assert(Obj::GetAliveObjectCount() == 5);
+            assert(v.UseCount() == 2);
+        }
+        assert(v.UseCount() == 1);
+        assert(Obj::GetAliveObjectCount() == 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Перемещение не выделяет память: moved-from объекты делят общий
+        // пустой блок и остаются полностью пригодными
+        SharedVector<int> source(3);
+        source[0] = 7;
+        SharedVector<int> taken(std::move(source));
+        assert(taken.Size() == 3);
+        assert(taken[0] == 7);
+        assert(source.Empty());
+
+        SharedVector<int> other(1);
+        other = std::move(taken);
+        assert(other.Size() == 3);
+        assert(taken.Empty());
+
+        // Мутация moved-from объекта отцепляется в приватный буфер
+        source.PushBack(5);
+        assert(source.Size() == 1 && source[0] == 5);
+        assert(taken.Empty());
+    }
+}
+
+void TestConcurrentVector() {
+    {
+        // Несколько писателей, читатель забирает накопленное параллельно
+        const size_t WRITERS = 8;
+        const size_t PER_WRITER = 20'000;
+        ConcurrentVector<size_t> shared(WRITERS * PER_WRITER);
+
+        std::vector<std::thread> workers;
+        for (size_t w = 0; w < WRITERS; ++w) {
+            workers.emplace_back([&shared, w] {
+                for (size_t i = 0; i < PER_WRITER; ++i) {
+                    shared.PushBack(w * PER_WRITER + i);
+                }
+            });
+        }
+
+        Vector<size_t> sink;
+        while (sink.Size() < WRITERS * PER_WRITER) {
+            shared.DrainTo(sink);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        assert(sink.Size() == WRITERS * PER_WRITER);
+        size_t sum = 0;
+        for (size_t value : sink) {
+            sum += value;
+        }
+        const size_t n = WRITERS * PER_WRITER;
+        assert(sum == n * (n - 1) / 2);
+    }
+    {
+        // Исчерпание зарезервированной ёмкости
+        ConcurrentVector<int> v(1);
+        assert(v.Capacity() == CONCURRENT_CHUNK_CAPACITY);
+        for (size_t i = 0; i < v.Capacity(); ++i) {
+            assert(v.TryEmplaceBack(1));
+        }
+        assert(!v.TryEmplaceBack(1));
+        try {
+            v.PushBack(1);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::length_error&) {
+        }
+    }
+    {
+        // Незабранные элементы разрушаются вместе с контейнером
+        Obj::ResetCounters();
+        {
+            ConcurrentVector<Obj> v(10);
+            v.TryEmplaceBack(1);
+            v.TryEmplaceBack(2);
+            assert(Obj::GetAliveObjectCount() == 2);
+
+            Vector<Obj> sink;
+            v.DrainTo(sink);
+            assert(sink.Size() == 2);
+            v.TryEmplaceBack(3);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void TestChunkedVector() {
+    {
+        // Маленькие сегменты, чтобы тест пересекал их границы
+        ChunkedVector<int, 64> v;
+        const size_t SEG = v.SegmentCapacity();
+        assert(SEG == 16);
+
+        v.PushBack(0);
+        int* first = &v[0];
+        for (size_t i = 1; i < SEG * 3 + 5; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+
+        // Рост не переносит существующие элементы
+        assert(&v[0] == first);
+        assert(v.Size() == SEG * 3 + 5);
+        assert(v.Capacity() == SEG * 4);
+        assert(v[SEG] == static_cast<int>(SEG));
+        assert(v[v.Size() - 1] == static_cast<int>(v.Size() - 1));
+
+        // Итератор произвольного доступа работает сквозь границы сегментов
+        long long sum = 0;
+        for (int value : v) {
+            sum += value;
+        }
+        const long long n = static_cast<long long>(v.Size());
+        assert(sum == n * (n - 1) / 2);
+        assert(*(v.begin() + SEG + 1) == static_cast<int>(SEG + 1));
+        assert(v.end() - v.begin() == static_cast<ptrdiff_t>(v.Size()));
+        assert(std::find(v.begin(), v.end(), 40) == v.begin() + 40);
+    }
+    {
+        Obj::ResetCounters();
+        ChunkedVector<Obj, 512> v;
+        const size_t SEG = v.SegmentCapacity();
+        for (size_t i = 0; i < SEG * 2; ++i) {
+            v.EmplaceBack(static_cast<int>(i));
+        }
+
+        // Переезд сегментов — это перенос дескрипторов, а не элементов
+        assert(Obj::num_moved == 0);
+        assert(Obj::num_copied == 0);
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(SEG * 2));
+
+        v.Resize(SEG / 2);
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(SEG / 2));
+        v.PopBack();
+        assert(v.Size() == SEG / 2 - 1);
+
+        ChunkedVector<Obj, 512> copy(v);
+        assert(copy.Size() == v.Size());
+        assert(copy[2].id == v[2].id);
+
+        ChunkedVector<Obj, 512> moved(std::move(copy));
+        assert(moved.Size() == v.Size());
+        assert(copy.Empty());
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        ChunkedVector<int, 64> v(100);
+        assert(v.Size() == 100);
+        assert(v[99] == 0);
+        v = ChunkedVector<int, 64>();
+        assert(v.Empty());
+    }
+}
+
+void TestSoAVector() {
+    {
+        // Частицы {x, y, z, flags}: ядро трогает только координаты
+        SoAVector<float, float, float, int> particles;
+        for (int i = 0; i < 1000; ++i) {
+            particles.EmplaceBack(static_cast<float>(i), static_cast<float>(2 * i),
+                                  static_cast<float>(3 * i), i % 2);
+        }
+        assert(particles.Size() == 1000);
+
+        // Плотный проход по одному полю
+        const float* xs = particles.Field<0>();
+        float sum_x = 0.0f;
+        for (size_t i = 0; i < particles.Size(); ++i) {
+            sum_x += xs[i];
+        }
+        assert(sum_x == 1000.0f * 999.0f / 2.0f);
+
+        auto [x, y, z, flags] = particles[10];
+        assert(x == 10.0f && y == 20.0f && z == 30.0f && flags == 0);
+        x = -1.0f;
+        assert(particles.Field<0>()[10] == -1.0f);
+
+        particles.Resize(10);
+        assert(particles.Size() == 10);
+        particles.Resize(20);
+        assert(particles.Field<3>()[15] == 0);
+        particles.PopBack();
+        assert(particles.Size() == 19);
+    }
+    {
+        // Нетривиальные поля: учёт живых объектов при росте и копировании
+        Obj::ResetCounters();
+        SoAVector<Obj, int> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(Obj{ i }, i);
+        }
+        assert(Obj::GetAliveObjectCount() == 100);
+        assert(std::get<0>(v[42]).id == 42);
+
+        SoAVector<Obj, int> copy(v);
+        assert(Obj::GetAliveObjectCount() == 200);
+        assert(std::get<1>(copy[42]) == 42);
+
+        SoAVector<Obj, int> moved(std::move(copy));
+        assert(Obj::GetAliveObjectCount() == 200);
+        assert(copy.Empty());
+        v = moved;
+        assert(Obj::GetAliveObjectCount() == 200);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+#ifdef VECTOR_ENABLE_TELEMETRY
+void TestTelemetry() {
+    {
+        VectorTelemetry& stats = GetVectorTelemetry();
+        stats.Reset();
+
+        Vector<int> v;
+        v.Reserve(100);
+        assert(stats.allocation_count == 1);
+        assert(stats.bytes_reserved == 100 * sizeof(int));
+        assert(stats.reallocation_count == 1);
+        assert(stats.elements_moved == 0);
+
+        // Дозапись сверх ёмкости — реаллокация с переносом всех элементов
+        v.Resize(100);
+        for (int i = 0; i < 1; ++i) {
+            v.PushBack(i);
+        }
+        assert(stats.reallocation_count == 2);
+        assert(stats.elements_moved == 100);
+        assert(stats.bytes_reserved == v.Capacity() * sizeof(int));
+
+        v.ShrinkToFit();
+        assert(stats.bytes_reserved == v.Size() * sizeof(int));
+    }
+    {
+        // Колбэк получает параметры каждого переезда
+        VectorTelemetry& stats = GetVectorTelemetry();
+        stats.Reset();
+        static ReallocationEvent last_event;
+        stats.on_reallocation = [](const ReallocationEvent& event) { last_event = event; };
+
+        Vector<int> v;
+        v.Reserve(8);
+        v.Resize(8);
+        v.PushBack(1);
+        assert(last_event.element_size == sizeof(int));
+        assert(last_event.old_capacity == 8);
+        assert(last_event.new_capacity == 16);
+        assert(last_event.elements_moved == 8);
+
+        stats.on_reallocation = nullptr;
     }
-    C(const C& /*other*/) noexcept {
-        ++copy_ctor;
+    {
+        // Освобождение буферов возвращает bytes_reserved к нулю
+        GetVectorTelemetry().Reset();
+        {
+            Vector<int> v(1000);
+            Vector<int> w(v);
+        }
+        VectorTelemetry& stats = GetVectorTelemetry();
+        assert(stats.bytes_reserved == 0);
+        assert(stats.allocation_count == stats.deallocation_count);
     }
-    C(C&& /*other*/) noexcept {
-        ++move_ctor;
+}
+#endif
+
+void TestComparisonAndHash() {
+    {
+        Vector<uint64_t> a;
+        Vector<uint64_t> b;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            a.PushBack(i);
+            b.PushBack(i);
+        }
+        assert(a == b);
+        assert(a.Hash() == b.Hash());
+
+        b[500] ^= 1;
+        assert(a != b);
+        assert(a.Hash() != b.Hash());
+        assert((a <=> b) == std::strong_ordering::less);
+
+        b.PopBack();
+        assert(a != b);
     }
-    C& operator=(const C& other) noexcept {
-        if (this != &other) {
-            ++copy_assign;
+    {
+        // Байтовый путь через memcmp: префикс решает, длина — при равенстве
+        Vector<unsigned char> shorter;
+        Vector<unsigned char> longer;
+        for (unsigned char c : { 1, 2, 3 }) {
+            shorter.PushBack(c);
+            longer.PushBack(c);
         }
-        return *this;
+        longer.PushBack(4);
+        assert(shorter < longer);
+        assert(longer > shorter);
+        Vector<unsigned char> bigger(shorter);
+        bigger[0] = 9;
+        assert(bigger > longer);
+    }
+    {
+        // Нетривиальные типы сравниваются и хешируются поэлементно
+        Vector<std::string> a;
+        Vector<std::string> b;
+        a.PushBack("alpha");
+        b.PushBack("alpha");
+        assert(a == b);
+        assert(a.Hash() == b.Hash());
+        b[0] = "beta";
+        assert(a < b);
+        assert(a.Hash() != b.Hash());
     }
-    C& operator=(C&& /*other*/) noexcept {
-        ++move_assign;
-        return *this;
+    {
+        // Хеши разных длин с одинаковым префиксом не совпадают
+        Vector<uint64_t> empty;
+        Vector<uint64_t> one(1);
+        assert(empty.Hash() != one.Hash());
+        assert((empty <=> one) == std::strong_ordering::less);
     }
-    ~C() {
-        ++dtor;
+}
+
+void TestSpan() {
+    {
+        Vector<uint8_t> buffer;
+        for (int i = 0; i < 100; ++i) {
+            buffer.PushBack(static_cast<uint8_t>(i));
+        }
+
+        // Срезы не копируют: все указывают внутрь буфера вектора
+        Span<uint8_t> all = buffer.View();
+        assert(all.Size() == 100);
+        assert(all.Data() == buffer.begin());
+
+        Span<uint8_t> header = all.First(4);
+        Span<uint8_t> payload = all.Subspan(4, 90);
+        Span<uint8_t> trailer = all.Last(6);
+        assert(header.Size() == 4 && header[3] == 3);
+        assert(payload.Size() == 90 && payload[0] == 4);
+        assert(trailer.Size() == 6 && trailer.Front() == 94 && trailer.Back() == 99);
+        assert(payload.Data() == buffer.begin() + 4);
+        assert(all.Subspan(96).Size() == 4);
+
+        // Запись через срез видна в исходном векторе
+        header[0] = 255;
+        assert(buffer[0] == 255);
     }
+    {
+        // Срез принимается массовыми операциями без пар (итератор, размер)
+        Vector<int> source;
+        for (int i = 0; i < 10; ++i) {
+            source.PushBack(i);
+        }
+        Vector<int> sink;
+        sink.AppendRange(source.View().First(5));
+        assert(sink.Size() == 5);
+        sink.InsertRange(sink.cbegin() + 1, source.View().Last(2));
+        assert(sink.Size() == 7);
+        assert(sink[1] == 8 && sink[2] == 9 && sink[3] == 1);
 
-    static void Reset() {
-        def_ctor = 0;
-        copy_ctor = 0;
-        move_ctor = 0;
-        copy_assign = 0;
-        move_assign = 0;
-        dtor = 0;
+        assert(SimdSum(Span<const int>(source.View())) == 45);
+        assert(SimdFind(Span<const int>(source.View()), 7) == 7);
+        SimdFill(source.View().Subspan(5), 0);
+        assert(source[4] == 4 && source[7] == 0);
+        assert(SimdCountIf(Span<const int>(source.View()), [](int x) { return x == 0; }) == 6);
     }
+}
+
+void TestSerialization() {
+    {
+        Vector<uint32_t> original;
+        for (uint32_t i = 0; i < 10'000; ++i) {
+            original.PushBack(i * 7);
+        }
+
+        std::stringstream stream;
+        original.WriteTo(stream);
 
-    inline static size_t def_ctor = 0;
-    inline static size_t copy_ctor = 0;
-    inline static size_t move_ctor = 0;
-    inline static size_t copy_assign = 0;
-    inline static size_t move_assign = 0;
-    inline static size_t dtor = 0;
-};
+        // Заголовок: uint64_t размер + uint32_t ширина + uint8_t порядок байтов
+        const size_t HEADER_SIZE = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint8_t);
+        assert(stream.str().size() == HEADER_SIZE + original.Size() * sizeof(uint32_t));
 
-void Dump() {
-    using namespace std;
-    cerr << "Def ctors: "sv << C::def_ctor              //
-        << ", Copy ctors: "sv << C::copy_ctor          //
-        << ", Move ctors: "sv << C::move_ctor          //
-        << ", Copy assignments: "sv << C::copy_assign  //
-        << ", Move assignments: "sv << C::move_assign  //
-        << ", Dtors: "sv << C::dtor << endl;
+        Vector<uint32_t> restored = Vector<uint32_t>::ReadFrom(stream);
+        assert(restored == original);
+    }
+    {
+        // Пустой вектор ходит туда-обратно
+        std::stringstream stream;
+        Vector<double>().WriteTo(stream);
+        assert(Vector<double>::ReadFrom(stream).Empty());
+    }
+    {
+        // Несовпадение ширины элемента — ошибка формата, а не мусор
+        std::stringstream stream;
+        Vector<uint32_t> v(3);
+        v.WriteTo(stream);
+        try {
+            Vector<uint64_t>::ReadFrom(stream);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+    }
+    {
+        // Обрезанный поток тоже
+        Vector<uint32_t> v(100);
+        std::stringstream stream;
+        v.WriteTo(stream);
+        std::stringstream truncated(stream.str().substr(0, 50));
+        try {
+            Vector<uint32_t>::ReadFrom(truncated);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+    }
 }
 
-void Benchmark() {
-    using namespace std;
-    try {
-        const size_t NUM = 10;
-        C c;
+void TestDeferredReclaim() {
+    {
+        // Синхронный Clear сохраняет ёмкость
+        Obj::ResetCounters();
+        Vector<Obj> v(100);
+        const size_t capacity = v.Capacity();
+        v.Clear();
+        assert(v.Empty());
+        assert(v.Capacity() == capacity);
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // Отложенный снос: горячий поток сразу получает пустой вектор,
+        // разрушение доезжает в фоне
+        Obj::ResetCounters();
+        Vector<Obj> v(10'000);
+        v.ClearDeferred();
+        assert(v.Empty());
+        assert(v.Capacity() == 0);
+
+        DeferredReclaimer::Instance().WaitIdle();
+        assert(Obj::GetAliveObjectCount() == 0);
+
+        // Вектор пригоден к повторному использованию
+        v.PushBack(Obj{ 1 });
+        assert(v.Size() == 1);
+        v.ClearDeferred();
+        DeferredReclaimer::Instance().WaitIdle();
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // Пустой вектор не порождает задач
+        Vector<int> v;
+        v.ClearDeferred();
+        assert(v.Empty());
+    }
+}
+
+void TestSortedVector() {
+    {
+        std::vector<int> raw = { 5, 1, 9, 3, 7 };
+        SortedVector<int> index(raw.begin(), raw.end());
+        assert(std::is_sorted(index.begin(), index.end()));
+        assert(index.Size() == 5);
+
+        assert(index.Contains(7));
+        assert(!index.Contains(4));
+        assert(index.Find(9) == index.end() - 1);
+        assert(index.Find(4) == index.end());
+        assert(*index.LowerBound(4) == 5);
+        assert(index.LowerBound(100) == index.end());
+
+        index.Insert(4);
+        assert(std::is_sorted(index.begin(), index.end()));
+        assert(*index.Find(4) == 4);
+    }
+    {
+        // Массовая вставка: один проход слияния
+        SortedVector<int> index;
+        Vector<int> base;
+        for (int i = 0; i < 1000; ++i) {
+            base.PushBack(i * 2);
+        }
+        index.InsertSorted(base.begin(), base.end());
+
+        Vector<int> batch;
+        for (int i = 0; i < 100; ++i) {
+            batch.PushBack(997 - i * 10);
+        }
+        index.InsertSorted(batch.View());
+
+        assert(index.Size() == 1100);
+        assert(std::is_sorted(index.begin(), index.end()));
+        assert(index.Contains(997));
+        assert(index.Contains(7));
+        assert(index.Contains(0));
+        assert(index.Contains(1998));
+    }
+    {
+        // Дубликаты: Count и массовое удаление
+        SortedVector<int> index;
+        int batch[] = { 3, 1, 3, 2, 3 };
+        index.InsertSorted(std::begin(batch), std::end(batch));
+        assert(index.Count(3) == 3);
+        assert(index.Erase(3) == 3);
+        assert(index.Size() == 2);
+        assert(index.Erase(42) == 0);
+        index.Erase(index.Find(1));
+        assert(index.Size() == 1 && index[0] == 2);
+    }
+    {
+        // Пользовательский компаратор
+        SortedVector<int, std::greater<int>> descending;
+        int keys[] = { 1, 5, 3 };
+        descending.InsertSorted(std::begin(keys), std::end(keys));
+        descending.Insert(4);
+        assert(std::is_sorted(descending.begin(), descending.end(), std::greater<int>()));
+        assert(descending[0] == 5);
+        assert(descending.Contains(4));
+    }
+    {
+        // T без конструктора по умолчанию: слияние идёт в сырую память
+        // и не требует временных "пустых" элементов
+        struct Key {
+            explicit Key(int value) : value(value) {}
+            bool operator<(const Key& rhs) const { return value < rhs.value; }
+            int value;
+        };
+
+        SortedVector<Key> index;
+        index.Insert(Key(5));
+        index.Insert(Key(1));
+
+        const Key batch[] = { Key(3), Key(0), Key(7) };
+        index.InsertSorted(batch, batch + 3);
+
+        assert(index.Size() == 5);
+        const int expected[] = { 0, 1, 3, 5, 7 };
+        for (size_t i = 0; i < 5; ++i) {
+            assert(index[i].value == expected[i]);
+        }
+    }
+}
+
+void TestStreamingCopy() {
+    {
+        // Переезд буфера больше порога идёт потоковым путём;
+        // содержимое обязано совпасть бит в бит
+        const size_t N = STREAMING_COPY_THRESHOLD / sizeof(uint64_t) + 12'345;
+        Vector<uint64_t> v;
+        v.Reserve(N);
+        for (size_t i = 0; i < N; ++i) {
+            v.UncheckedEmplaceBack(i * 0x9E3779B97F4A7C15ull);
+        }
+
+        v.Reserve(N * 2);
+        bool intact = true;
+        for (size_t i = 0; i < N; ++i) {
+            intact = intact && v[i] == i * 0x9E3779B97F4A7C15ull;
+        }
+        assert(intact);
+    }
+    {
+        // Ядро корректно при невыровненном приёмнике и хвосте не кратном блоку
+        std::vector<unsigned char> source(257);
+        for (size_t i = 0; i < source.size(); ++i) {
+            source[i] = static_cast<unsigned char>(i * 31);
+        }
+        std::vector<unsigned char> dest(source.size() + 3, 0xEE);
+        for (size_t shift = 0; shift < 3; ++shift) {
+            StreamCopyBytes(dest.data() + shift, source.data(), source.size());
+            assert(std::equal(source.begin(), source.end(), dest.begin() + shift));
+        }
+    }
+}
+
+void TestBitVector() {
+    {
+        BitVector bits;
+        for (int i = 0; i < 200; ++i) {
+            bits.PushBack(i % 3 == 0);
+        }
+        assert(bits.Size() == 200);
+        assert(bits[0] && !bits[1] && bits[99]);
+        assert(bits.Count() == 67);
+
+        bits.Set(1);
+        bits.Reset(0);
+        assert(!bits[0] && bits[1]);
+        assert(bits.Count() == 67);
+    }
+    {
+        // Пословная дозапись, в том числе с хвостом посреди слова
+        BitVector bits;
+        bits.PushBackWord(0xFFFFFFFFFFFFFFFFull);
+        assert(bits.Size() == 64 && bits.Count() == 64);
+        bits.PushBack(false);
+        bits.PushBackWord(0xFFull, 8);
+        assert(bits.Size() == 73);
+        assert(!bits[64] && bits[65] && bits[72]);
+        assert(bits.Count() == 72);
+        bits.PushBackWord(~uint64_t{ 0 });
+        assert(bits.Size() == 137 && bits.Count() == 136);
+    }
+    {
+        // Массовые диапазоны поверх границ слов
+        BitVector bits(300);
+        assert(bits.Count() == 0);
+        bits.SetRange(10, 200);
+        assert(bits.Count() == 190);
+        assert(!bits[9] && bits[10] && bits[199] && !bits[200]);
+        bits.ResetRange(63, 129);
+        assert(bits.Count() == 190 - 66);
+        assert(bits[62] && !bits[63] && !bits[128] && bits[129]);
+        bits.SetRange(0, 300);
+        assert(bits.Count() == 300);
+    }
+    {
+        // Пересечение масок — ядро фильтрации
+        const size_t N = 1'000'000;
+        BitVector evens(N);
+        BitVector thirds(N);
+        for (size_t i = 0; i < N; i += 2) {
+            evens.Set(i);
+        }
+        for (size_t i = 0; i < N; i += 3) {
+            thirds.Set(i);
+        }
+
+        BitVector both(evens);
+        both.And(thirds);
+        assert(both.Count() == (N + 5) / 6);
+        assert(both[6] && !both[2] && !both[3]);
+
+        BitVector either(evens);
+        either.Or(thirds);
+        assert(either.Count() == N / 2 + (N + 2) / 3 - (N + 5) / 6);
+
+        BitVector only_evens(evens);
+        only_evens.AndNot(thirds);
+        assert(only_evens[2] && !only_evens[6]);
+        assert(only_evens.Count() == N / 2 - (N + 5) / 6);
+    }
+    {
+        // Resize сохраняет инвариант чистого хвоста
+        BitVector bits(70);
+        bits.SetRange(0, 70);
+        bits.Resize(10);
+        assert(bits.Count() == 10);
+        bits.Resize(70);
+        assert(bits.Count() == 10);
+        assert(!bits[69]);
+    }
+}
+
+namespace {
+
+    // Перемещение нарочно не noexcept: в обычной сборке строгая гарантия
+    // заставит Reserve копировать, в мире без исключений — переместит
+    struct SuspectMove {
+        SuspectMove() = default;
+        SuspectMove(const SuspectMove&) { ++num_copied; }
+        SuspectMove(SuspectMove&&) { ++num_moved; }
+        SuspectMove& operator=(const SuspectMove&) = default;
+        SuspectMove& operator=(SuspectMove&&) = default;
+
+        static inline int num_copied = 0;
+        static inline int num_moved = 0;
+    };
+
+    // Копируемый тип с не-noexcept перемещением: переезд буфера обязан
+    // идти через копирование с сохранением старого буфера до конца.
+    // Счётчик copies_until_throw взводит исключение на N-й копии
+    struct FragileCopy {
+        explicit FragileCopy(int value) : value(value) {}
+
+        FragileCopy(const FragileCopy& other) : value(other.value) {
+            if (copies_until_throw == 0) {
+                throw std::runtime_error("копия запрещена");
+            }
+            if (copies_until_throw > 0) {
+                --copies_until_throw;
+            }
+        }
+
+        FragileCopy(FragileCopy&& other) : value(other.value) {}
+        FragileCopy& operator=(const FragileCopy&) = default;
+        FragileCopy& operator=(FragileCopy&&) = default;
+
+        ~FragileCopy() {
+            value = -1;
+        }
+
+        int value;
+        static inline int copies_until_throw = -1;
+    };
+
+}  // namespace
+
+void TestSelfRangeInsertion() {
+    {
+        // Дозапись вектора самим собой переживает реаллокацию
+        Vector<int> v;
+        for (int i = 0; i < 5; ++i) {
+            v.PushBack(i);
+        }
+        v.ShrinkToFit();
+        v.AppendRange(v.begin(), v.end());
+        assert(v.Size() == 10);
+        for (int i = 0; i < 5; ++i) {
+            assert(v[i] == i);
+            assert(v[i + 5] == i);
+        }
+    }
+    {
+        // Span из собственного View — то же самое одной строкой
+        Vector<int> v;
+        for (int i = 0; i < 4; ++i) {
+            v.PushBack(i);
+        }
+        v.AppendRange(v.View());
+        assert(v.Size() == 8);
+        assert(v[4] == 0 && v[7] == 3);
+    }
+    {
+        // Самовставка в середину с реаллокацией
+        Vector<int> v;
+        for (int i = 0; i < 4; ++i) {
+            v.PushBack(i);
+        }
+        v.ShrinkToFit();
+        v.InsertRange(v.begin() + 2, v.begin(), v.end());
+        assert(v.Size() == 8);
+        const int expected[] = { 0, 1, 0, 1, 2, 3, 2, 3 };
+        for (size_t i = 0; i < 8; ++i) {
+            assert(v[i] == expected[i]);
+        }
+    }
+    {
+        // Без реаллокации источник затирал бы сдвиг хвоста
+        Vector<int> v;
+        for (int i = 0; i < 3; ++i) {
+            v.PushBack(i);
+        }
+        v.Reserve(16);
+        v.InsertRange(v.begin() + 1, v.begin() + 1, v.begin() + 3);
+        assert(v.Size() == 5);
+        const int expected[] = { 0, 1, 2, 1, 2 };
+        for (size_t i = 0; i < 5; ++i) {
+            assert(v[i] == expected[i]);
+        }
+    }
+    {
+        // Нетривиальный тип: учёт живых объектов сходится
+        Obj::ResetCounters();
         {
-            cerr << "std::vector:"sv << endl;
-            C::Reset();
-            vector<C> v(NUM);
-            Dump();
-            v.push_back(c);
+            Vector<Obj> v;
+            for (int i = 0; i < 3; ++i) {
+                v.EmplaceBack(i);
+            }
+            v.ShrinkToFit();
+            v.AppendRange(v.begin(), v.end());
+            assert(v.Size() == 6);
+            assert(v[3].id == 0 && v[5].id == 2);
+            assert(Obj::GetAliveObjectCount() == 6);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void TestSmallVectorSuspectMove() {
+    // Перемещение контейнера с не-noexcept move-типом переносит
+    // инлайн-элементы перемещением, а не копированием с подстраховкой:
+    // копия могла бы бросить внутри noexcept-перемещения и уронить процесс
+    static_assert(std::is_nothrow_move_constructible_v<SmallVector<int, 4>>);
+#ifndef VECTOR_ASSUME_NOTHROW
+    static_assert(!std::is_nothrow_move_constructible_v<SmallVector<SuspectMove, 4>>);
+#endif
+
+    SmallVector<SuspectMove, 4> src;
+    src.EmplaceBack();
+    src.EmplaceBack();
+
+    SuspectMove::num_copied = 0;
+    SuspectMove::num_moved = 0;
+    SmallVector<SuspectMove, 4> dst(std::move(src));
+    assert(dst.Size() == 2);
+    assert(SuspectMove::num_copied == 0);
+    assert(SuspectMove::num_moved == 2);
+
+    SmallVector<SuspectMove, 4> assigned;
+    assigned = std::move(dst);
+    assert(assigned.Size() == 2);
+    assert(SuspectMove::num_copied == 0);
+}
+
+// GCC 12 ложно срабатывает -Warray-bounds на construct_at в новый буфер
+// после operator new (PR105329); по существу доступ проверен тестом под ASan
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+
+void TestGrowRollbackTwoSegments() {
+#ifndef VECTOR_ASSUME_NOTHROW
+    {
+        // Emplace в середину заполненного вектора переносит старые элементы
+        // двумя сегментами; исключение из хвостового сегмента не должно
+        // оставить префикс разрушенным
+        Vector<FragileCopy> v;
+        v.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        FragileCopy::copies_until_throw = 3;
+        bool thrown = false;
+        try {
+            v.Emplace(v.begin() + 2, 99);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        FragileCopy::copies_until_throw = -1;
+
+        assert(thrown);
+        assert(v.Size() == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(v[i].value == i);
         }
-        Dump();
     }
-    catch (...) {
+    {
+        // Тот же сценарий для InsertRange: вставляемая партия копируется
+        // успешно, бросает копия из хвоста старого буфера
+        Vector<FragileCopy> v;
+        v.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        const FragileCopy batch[] = { FragileCopy(7), FragileCopy(8) };
+        FragileCopy::copies_until_throw = 5;
+        bool thrown = false;
+        try {
+            v.InsertRange(v.begin() + 2, batch, batch + 2);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        FragileCopy::copies_until_throw = -1;
+
+        assert(thrown);
+        assert(v.Size() == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(v[i].value == i);
+        }
+    }
+#endif
+}
+
+#pragma GCC diagnostic pop
+
+void TestCheckedAccess() {
+    Vector<int> v;
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i);
     }
+
+    // At проверяет границу во всех режимах сборки
+    assert(v.At(0) == 0 && v.At(9) == 9);
+    v.At(3) = 33;
+    assert(v[3] == 33);
+
+    bool thrown = false;
     try {
-        const size_t NUM = 10;
-        C c;
+        v.At(10);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    const Vector<int>& cv = v;
+    assert(cv.At(9) == 9);
+
+    // Data — тот же буфер, что и у итераторов и operator[]
+    assert(v.Data() == &v[0]);
+    assert(cv.Data() == v.begin());
+    v.Data()[5] = 55;
+    assert(v[5] == 55);
+}
+
+void TestNumaAllocators() {
+    {
+        // Привязка к узлу 0 есть на любой машине; проверяем обычную
+        // семантику вектора поверх mmap-буфера
+        Vector<int, NumaNodeAllocator<int>> v(NumaNodeAllocator<int>(0));
+        for (int i = 0; i < 5'000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 5'000);
+        assert(v[4'999] == 4'999);
+        v.ShrinkToFit();
+        assert(v[0] == 0 && v[4'999] == 4'999);
+    }
+    {
+        // Interleave по всем доступным узлам (на одноузловой машине
+        // эквивалентно обычному размещению)
+        Vector<uint64_t, NumaInterleaveAllocator<uint64_t>> v;
+        v.Resize(10'000);
+        v.Fill(42);
+        assert(v.Sum() == 42ull * 10'000);
+    }
+    {
+        // First-touch в паре с параллельной инициализацией: каждый
+        // воркер первым трогает страницы своего диапазона
+        Vector<int, NumaFirstTouchAllocator<int>> v(
+            1'000'000, std::execution::par, NumaFirstTouchAllocator<int>());
+        assert(v.Size() == 1'000'000);
+        assert(v[0] == 0 && v[999'999] == 0);
+    }
+}
+
+void TestForEachChunk() {
+    Vector<int> v;
+    for (int i = 0; i < 1'000; ++i) {
+        v.PushBack(i);
+    }
+
+    {
+        // Блоки покрывают буфер без дыр и перекрытий
+        long long sum = 0;
+        size_t chunks = 0;
+        v.ForEachChunk([&](Span<const int> block) {
+            assert(!block.Empty());
+            assert(block.Size() <= 64 / sizeof(int));
+            for (int x : block) {
+                sum += x;
+            }
+            ++chunks;
+        }, 64);
+        assert(sum == 999LL * 1'000 / 2);
+        assert(chunks == (1'000 + 15) / 16);
+    }
+    {
+        // Неконстантный обход мутирует элементы по месту
+        v.ForEachChunk([](Span<int> block) {
+            for (int& x : block) {
+                x *= 2;
+            }
+        });
+        assert(v[0] == 0 && v[999] == 1'998);
+    }
+    {
+        // Диапазонный вариант: две партиции дают ту же сумму, что и весь обход
+        long long left = 0;
+        long long right = 0;
+        v.ForEachChunk(0, 500, [&](Span<const int> block) {
+            for (int x : block) {
+                left += x;
+            }
+        }, 256);
+        v.ForEachChunk(500, 1'000, [&](Span<const int> block) {
+            for (int x : block) {
+                right += x;
+            }
+        }, 256);
+        assert(left + right == 2LL * 999 * 1'000 / 2);
+    }
+}
+
+namespace {
+
+    // Обёртка над хэндлом: не тривиально копируема (свои move и деструктор),
+    // но перемещение + разрушение источника эквивалентны memcpy
+    struct RelocHandle {
+        explicit RelocHandle(int value)
+            : handle(new int(value))
         {
-            cerr << "Vector:"sv << endl;
-            C::Reset();
-            Vector<C> v(NUM);
-            Dump();
-            v.PushBack(c);
         }
-        Dump();
+
+        RelocHandle(RelocHandle&& other) noexcept
+            : handle(std::exchange(other.handle, nullptr))
+        {
+            ++num_moved;
+        }
+
+        RelocHandle& operator=(RelocHandle&& other) noexcept {
+            std::swap(handle, other.handle);
+            ++num_moved;
+            return *this;
+        }
+
+        ~RelocHandle() {
+            ++num_destroyed;
+            delete handle;
+        }
+
+        int* handle = nullptr;
+
+        static inline int num_moved = 0;
+        static inline int num_destroyed = 0;
+    };
+
+}  // namespace
+
+template <>
+struct IsTriviallyRelocatable<RelocHandle> : std::true_type {};
+
+void TestTrivialRelocation() {
+    {
+        // Рост буфера релоцирует memcpy-ем: ни перемещений, ни разрушений
+        Vector<RelocHandle> v;
+        v.Reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        RelocHandle::num_moved = 0;
+        RelocHandle::num_destroyed = 0;
+        v.Reserve(100);
+        assert(RelocHandle::num_moved == 0);
+        assert(RelocHandle::num_destroyed == 0);
+        for (int i = 0; i < 4; ++i) {
+            assert(*v[i].handle == i);
+        }
+
+        // Рост из EmplaceBack — тот же перенос без вызовов конструкторов
+        for (int i = 4; i < 200; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(RelocHandle::num_moved == 0);
+        assert(RelocHandle::num_destroyed == 0);
+        assert(*v[199].handle == 199);
+    }
+    {
+        // realloc-аллокатор: Reserve расширяет блок без переноса элементов
+        Vector<RelocHandle, MallocAllocator<RelocHandle>> v;
+        v.Reserve(8);
+        for (int i = 0; i < 8; ++i) {
+            v.EmplaceBack(i);
+        }
+
+        RelocHandle::num_moved = 0;
+        RelocHandle::num_destroyed = 0;
+        v.Reserve(100'000);
+        assert(RelocHandle::num_moved == 0);
+        assert(RelocHandle::num_destroyed == 0);
+        assert(*v[7].handle == 7);
     }
-    catch (...) {
+    {
+        // Интовый вектор на malloc-аллокаторе: обычная семантика
+        Vector<int, MallocAllocator<int>> v;
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 10'000);
+        assert(v[9'999] == 9'999);
+        v.ShrinkToFit();
+        assert(v.Capacity() == v.Size());
     }
 }
 
+void TestNothrowWorldPolicy() {
+    SuspectMove::num_copied = 0;
+    SuspectMove::num_moved = 0;
+
+    Vector<SuspectMove> v(100);
+    v.Reserve(200);
+
+#ifdef VECTOR_ASSUME_NOTHROW
+    assert(SuspectMove::num_moved == 100);
+    assert(SuspectMove::num_copied == 0);
+#else
+    assert(SuspectMove::num_copied == 100);
+    assert(SuspectMove::num_moved == 0);
+#endif
+}
+
 int main()
 {
     try {
@@ -656,7 +2199,38 @@ int main()
         Test4();
         Test5();
         Test6();
-        Benchmark();
+        Test7();
+        TestCapacityControl();
+        TestFastAppend();
+        TestParallelInit();
+        TestBulkErase();
+        TestAlignedAndHugePages();
+        TestMappedVector();
+        TestArenaAllocator();
+        TestSmallVector();
+        TestSimdAlgorithms();
+        TestSharedVector();
+        TestConcurrentVector();
+        TestChunkedVector();
+        TestSoAVector();
+        TestComparisonAndHash();
+        TestSpan();
+        TestSerialization();
+        TestDeferredReclaim();
+        TestSortedVector();
+        TestStreamingCopy();
+        TestBitVector();
+        TestNothrowWorldPolicy();
+        TestTrivialRelocation();
+        TestForEachChunk();
+        TestNumaAllocators();
+        TestCheckedAccess();
+        TestGrowRollbackTwoSegments();
+        TestSmallVectorSuspectMove();
+        TestSelfRangeInsertion();
+#ifdef VECTOR_ENABLE_TELEMETRY
+        TestTelemetry();
+#endif
     }
     catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Отображённый в память файл с интерфейсом по образцу RawMemory:
+// GetAddress/Capacity/Swap. Загрузка вектора из файла — это mmap и
+// подкачка страниц по требованию вместо чтения и копирования всего буфера
+template <typename T>
+class MappedMemory
+{
+public:
+    MappedMemory() = default;
+
+    explicit MappedMemory(const char* path)
+    {
+        fd_ = ::open(path, O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0)
+            throw std::runtime_error("MappedMemory: не удалось открыть файл");
+
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("MappedMemory: не удалось получить размер файла");
+        }
+
+        capacity_ = static_cast<size_t>(st.st_size) / sizeof(T);
+        if (capacity_ != 0)
+            Map(capacity_);
+    }
+
+    MappedMemory(const MappedMemory&) = delete;
+    MappedMemory& operator=(const MappedMemory&) = delete;
+
+    MappedMemory(MappedMemory&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1))
+        , buffer_(std::exchange(other.buffer_, nullptr))
+        , capacity_(std::exchange(other.capacity_, 0))
+    {
+    }
+
+    ~MappedMemory()
+    {
+        Unmap();
+        if (fd_ >= 0)
+            ::close(fd_);
+    }
+
+    // Растягивает файл до new_capacity элементов и перестраивает отображение.
+    // Новые байты файла читаются нулями — семантика Resize сохраняется
+    void Remap(size_t new_capacity)
+    {
+        if (::ftruncate(fd_, static_cast<off_t>(new_capacity * sizeof(T))) != 0)
+            throw std::runtime_error("MappedMemory: не удалось изменить размер файла");
+
+#if defined(__linux__)
+        if (buffer_ != nullptr)
+        {
+            void* remapped = ::mremap(buffer_, capacity_ * sizeof(T),
+                                      new_capacity * sizeof(T), MREMAP_MAYMOVE);
+            if (remapped == MAP_FAILED)
+                throw std::bad_alloc();
+
+            buffer_ = static_cast<T*>(remapped);
+            capacity_ = new_capacity;
+            return;
+        }
+#endif
+        Unmap();
+        Map(new_capacity);
+        capacity_ = new_capacity;
+    }
+
+    // Обрезает файл до count элементов (отображение при этом снимается;
+    // вызывается при завершении работы с файлом)
+    void TruncateTo(size_t count) noexcept
+    {
+        Unmap();
+        if (fd_ >= 0)
+            static_cast<void>(::ftruncate(fd_, static_cast<off_t>(count * sizeof(T))));
+    }
+
+    // Сбрасывает содержимое отображения на диск
+    void Flush()
+    {
+        if (buffer_ != nullptr && ::msync(buffer_, capacity_ * sizeof(T), MS_SYNC) != 0)
+            throw std::runtime_error("MappedMemory: msync не удался");
+    }
+
+    void Swap(MappedMemory& other) noexcept
+    {
+        std::swap(fd_, other.fd_);
+        std::swap(buffer_, other.buffer_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    const T* GetAddress() const noexcept
+    {
+        return buffer_;
+    }
+
+    T* GetAddress() noexcept
+    {
+        return buffer_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+private:
+    void Map(size_t count)
+    {
+        void* mapped = ::mmap(nullptr, count * sizeof(T), PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd_, 0);
+        if (mapped == MAP_FAILED)
+            throw std::bad_alloc();
+
+        buffer_ = static_cast<T*>(mapped);
+    }
+
+    void Unmap() noexcept
+    {
+        if (buffer_ != nullptr)
+        {
+            ::munmap(buffer_, capacity_ * sizeof(T));
+            buffer_ = nullptr;
+        }
+    }
+
+private:
+    int fd_ = -1;
+    T* buffer_ = nullptr;
+    size_t capacity_ = 0;
+};
+
+// Вектор на файловом хранилище: контейнер с API Vector поверх MappedMemory.
+// Отдельный класс, а не параметр хранилища Vector, потому что рост здесь —
+// это ftruncate и remap того же файла, а не новый буфер с переездом данных
+template <typename T, typename Growth = DoubleGrowth>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "MappedVector допустим только для тривиально копируемых T");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Открывает (или создаёт) файл; существующее содержимое становится
+    // элементами вектора без какого-либо чтения
+    explicit MappedVector(const char* path)
+        : data_(path)
+        , size_(data_.Capacity())
+    {
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : data_(std::move(other.data_))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    // При разрушении файл обрезается до фактического размера,
+    // чтобы не хранить на диске неиспользованную ёмкость
+    ~MappedVector()
+    {
+        data_.TruncateTo(size_);
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<MappedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return data_.GetAddress()[index];
+    }
+
+    iterator begin() noexcept { return data_.GetAddress(); }
+    iterator end() noexcept { return data_.GetAddress() + size_; }
+
+    const_iterator begin() const noexcept { return data_.GetAddress(); }
+    const_iterator end() const noexcept { return data_.GetAddress() + size_; }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return data_.Capacity();
+    }
+
+    bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity > data_.Capacity())
+            data_.Remap(new_capacity);
+    }
+
+    // Новые элементы читаются нулями: расширение файла зануляет страницы
+    void Resize(size_t new_size)
+    {
+        Reserve(new_size);
+        size_ = new_size;
+    }
+
+    template <class Value>
+    void PushBack(Value&& value)
+    {
+        if (size_ == Capacity())
+            data_.Remap(Growth::Next(Capacity()));
+
+        data_.GetAddress()[size_] = std::forward<Value>(value);
+        ++size_;
+    }
+
+    void PopBack() noexcept
+    {
+        if (size_ != 0)
+            --size_;
+    }
+
+    // Гарантированно доносит содержимое до диска
+    void Flush()
+    {
+        data_.Flush();
+    }
+
+private:
+    MappedMemory<T> data_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// NUMA-размещение буферов. На многосокетных машинах страница живёт
+// в памяти конкретного узла, и обращение с чужого сокета идёт через
+// межсокетную шину — в разы медленнее локального. Буфер, который
+// загрузчик выделил и заполнил на узле 0, превращает сканы с других
+// сокетов в сплошной удалённый трафик. Три стратегии ниже дают
+// контроль над размещением: на заданном узле, вперемешку по узлам
+// и first-touch под параллельную инициализацию.
+//
+// Только Linux; на остальных платформах аллокаторы вырождаются
+// в обычный operator new. Привязка — best effort: на ядре без NUMA
+// или в урезанном cpuset память остаётся валидной с политикой
+// по умолчанию
+
+#if defined(__linux__)
+
+// Константы политик ядра (см. MPOL_* в linux/mempolicy.h);
+// продублированы локально, чтобы не тянуть зависимость от libnuma
+inline constexpr int NUMA_POLICY_BIND = 2;
+inline constexpr int NUMA_POLICY_INTERLEAVE = 3;
+
+// Маска узлов, с которых текущему процессу разрешено выделять память
+inline unsigned long NumaAllowedNodeMask() noexcept
+{
+    constexpr int MEMS_ALLOWED_FLAG = 1 << 2;  // MPOL_F_MEMS_ALLOWED
+    unsigned long mask = 0;
+    if (syscall(SYS_get_mempolicy, nullptr, &mask, sizeof(mask) * 8,
+                nullptr, MEMS_ALLOWED_FLAG) != 0)
+        mask = 1;
+    return mask;
+}
+
+// Назначает политику размещения страницам [addr, addr + bytes)
+inline void NumaBindPages(void* addr, size_t bytes, int policy,
+                          unsigned long node_mask) noexcept
+{
+    syscall(SYS_mbind, addr, bytes, policy, &node_mask,
+            sizeof(node_mask) * 8 + 1, 0ul);
+}
+
+#endif
+
+// Общий для NUMA-аллокаторов mmap-бэкенд: свежие, ещё не тронутые
+// страницы, к которым применима политика размещения
+template <typename T>
+struct NumaMmapAllocatorBase
+{
+    T* Allocate(size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+
+        const size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+        void* pages = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED)
+            throw std::bad_alloc();
+        return static_cast<T*>(pages);
+#else
+        return static_cast<T*>(operator new(bytes));
+#endif
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept
+    {
+        if (buf == nullptr)
+            return;
+
+#if defined(__linux__)
+        munmap(buf, n * sizeof(T));
+#else
+        (void)n;
+        operator delete(buf);
+#endif
+    }
+};
+
+// Размещает буфер целиком на заданном узле. Для данных, которые
+// читает в основном один сокет: его потоки ходят только в локальную
+// память
+template <typename T>
+struct NumaNodeAllocator : NumaMmapAllocatorBase<T>
+{
+    NumaNodeAllocator() = default;
+
+    explicit NumaNodeAllocator(int node) noexcept
+        : node(node)
+    {
+    }
+
+    T* Allocate(size_t n)
+    {
+        T* buf = NumaMmapAllocatorBase<T>::Allocate(n);
+#if defined(__linux__)
+        if (buf != nullptr)
+            NumaBindPages(buf, n * sizeof(T), NUMA_POLICY_BIND,
+                          1ul << node);
+#endif
+        return buf;
+    }
+
+    int node = 0;
+};
+
+// Раскладывает страницы буфера вперемешку по узлам из маски
+// (по умолчанию — по всем доступным). Для данных, которые равномерно
+// читают потоки со всех сокетов: удалённые обращения неизбежны,
+// но нагрузка на контроллеры памяти и межсокетную шину выравнивается
+// вместо того, чтобы упираться в один узел
+template <typename T>
+struct NumaInterleaveAllocator : NumaMmapAllocatorBase<T>
+{
+    NumaInterleaveAllocator() = default;
+
+    explicit NumaInterleaveAllocator(unsigned long node_mask) noexcept
+        : node_mask(node_mask)
+    {
+    }
+
+    T* Allocate(size_t n)
+    {
+        T* buf = NumaMmapAllocatorBase<T>::Allocate(n);
+#if defined(__linux__)
+        if (buf != nullptr)
+            NumaBindPages(buf, n * sizeof(T), NUMA_POLICY_INTERLEAVE,
+                          node_mask != 0 ? node_mask : NumaAllowedNodeMask());
+#endif
+        return buf;
+    }
+
+    unsigned long node_mask = 0;
+};
+
+// First-touch: страницы выделяются лениво и физически привязываются
+// к узлу того потока, который первым в них запишет. Аллокатор лишь
+// гарантирует свежий, не тронутый mmap-блок (куча могла бы подсунуть
+// уже размещённые страницы); раскладку делает параллельная
+// инициализация — Vector(size, std::execution::par, alloc) или
+// Resize(n, std::execution::par), где каждый воркер конструирует свой
+// диапазон и тем самым притягивает его страницы на свой узел
+template <typename T>
+struct NumaFirstTouchAllocator : NumaMmapAllocatorBase<T>
+{
+};
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+// Вектор-снимок с копированием при записи: копия — это O(1) приращение
+// счётчика ссылок на общий буфер, а не uninitialized_copy_n всего
+// содержимого. Первая мутация при живых копиях переезжает в приватный
+// буфер тем же путём reallocate-and-move, что и рост Vector. Читатели
+// продолжают видеть свой снимок нетронутым
+template <typename T, typename Growth = DoubleGrowth>
+class SharedVector
+{
+    // Общий владелец буфера: хранилище, число сконструированных элементов
+    // и атомарный счётчик ссылок
+    struct ControlBlock
+    {
+        RawMemory<T> memory;
+        size_t size = 0;
+        std::atomic<size_t> refs{ 1 };
+
+        explicit ControlBlock(size_t capacity)
+            : memory(capacity)
+        {
+        }
+
+        ControlBlock() = default;
+
+        ~ControlBlock()
+        {
+            std::destroy_n(memory.GetAddress(), size);
+        }
+    };
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SharedVector()
+        : block_(new ControlBlock())
+    {
+    }
+
+    explicit SharedVector(size_t size)
+        : block_(new ControlBlock(size))
+    {
+        ValueConstructRange(block_->memory.GetAddress(), size);
+        block_->size = size;
+    }
+
+    // Снимок: общий буфер, счётчик ссылок вместо копирования элементов
+    SharedVector(const SharedVector& other) noexcept
+        : block_(other.block_)
+    {
+        block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    SharedVector(SharedVector&& other) noexcept
+        : block_(std::exchange(other.block_, AcquireEmptyBlock()))
+    {
+    }
+
+    SharedVector& operator=(const SharedVector& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            SharedVector copy(rhs);
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    SharedVector& operator=(SharedVector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            SharedVector moved(std::move(rhs));
+            Swap(moved);
+        }
+        return *this;
+    }
+
+    ~SharedVector()
+    {
+        Release();
+    }
+
+    // Чтение не трогает счётчик ссылок и безопасно при живых копиях
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(index < block_->size);
+        return block_->memory.GetAddress()[index];
+    }
+
+    // Запись по индексу — мутация: при живых копиях сначала переезд
+    // в приватный буфер
+    T& operator[](size_t index)
+    {
+        assert(index < block_->size);
+        Detach(Capacity());
+        return block_->memory.GetAddress()[index];
+    }
+
+    const_iterator begin() const noexcept { return block_->memory.GetAddress(); }
+    const_iterator end() const noexcept { return begin() + block_->size; }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    iterator begin()
+    {
+        Detach(Capacity());
+        return block_->memory.GetAddress();
+    }
+
+    iterator end()
+    {
+        return begin() + block_->size;
+    }
+
+    size_t Size() const noexcept
+    {
+        return block_->size;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return block_->memory.Capacity();
+    }
+
+    bool Empty() const noexcept
+    {
+        return block_->size == 0;
+    }
+
+    // true, если буфер разделён хотя бы с одной копией
+    bool Shared() const noexcept
+    {
+        return block_->refs.load(std::memory_order_relaxed) > 1;
+    }
+
+    size_t UseCount() const noexcept
+    {
+        return block_->refs.load(std::memory_order_relaxed);
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity > Capacity() || Shared())
+            Detach(std::max(new_capacity, Capacity()));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (Shared() || block_->size == Capacity())
+        {
+            const size_t new_capacity =
+                block_->size == Capacity() ? Growth::Next(Capacity()) : Capacity();
+            Detach(new_capacity);
+        }
+
+        T* slot = block_->memory.GetAddress() + block_->size;
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++block_->size;
+        return *slot;
+    }
+
+    template <class Value>
+    void PushBack(Value&& value)
+    {
+        EmplaceBack(std::forward<Value>(value));
+    }
+
+    void PopBack()
+    {
+        assert(!Empty());
+        Detach(Capacity());
+        --block_->size;
+        std::destroy_at(block_->memory.GetAddress() + block_->size);
+    }
+
+    void Swap(SharedVector& other) noexcept
+    {
+        std::swap(block_, other.block_);
+    }
+
+private:
+    // Пустой блок, разделяемый всеми moved-from объектами: перемещение
+    // не выделяет память и потому честно noexcept. Собственная ссылка
+    // блока никогда не отпускается — он живёт до конца программы,
+    // а мутация moved-from объекта видит Shared() и уезжает в приватный
+    // буфер обычным Detach
+    static ControlBlock* AcquireEmptyBlock() noexcept
+    {
+        static ControlBlock empty;
+        empty.refs.fetch_add(1, std::memory_order_relaxed);
+        return &empty;
+    }
+
+    // Переезд в приватный буфер ёмкости new_capacity. Если буфер разделён,
+    // элементы копируются (снимки продолжают владеть исходными); если мы
+    // единственный владелец, работает обычный перенос через CopyDataRange
+    void Detach(size_t new_capacity)
+    {
+        if (!Shared() && new_capacity <= Capacity())
+            return;
+
+        ControlBlock* fresh = new ControlBlock(new_capacity);
+        try
+        {
+            if (Shared())
+                std::uninitialized_copy_n(block_->memory.GetAddress(), block_->size,
+                                          fresh->memory.GetAddress());
+            else
+                CopyDataRange(block_->memory.GetAddress(), block_->size,
+                              fresh->memory.GetAddress());
+        }
+        catch (...)
+        {
+            delete fresh;
+            throw;
+        }
+
+        fresh->size = block_->size;
+        Release();
+        block_ = fresh;
+    }
+
+    void Release() noexcept
+    {
+        if (block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete block_;
+    }
+
+private:
+    ControlBlock* block_ = nullptr;
+};
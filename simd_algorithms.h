@@ -0,0 +1,383 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "span.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Векторизованные ядра для операций над непрерывным буфером. Явные
+// AVX2-варианты включаются при сборке с -mavx2; без него остаются скалярные
+// циклы, написанные так, чтобы автовекторизация с ними справлялась.
+// Единая реализация вместо самодельных intrinsics-циклов в каждом сервисе
+
+template <typename T>
+void SimdFill(T* data, size_t count, const T& value)
+{
+    // std::fill_n для тривиальных типов сводится к memset/векторному циклу
+    std::fill_n(data, count, value);
+}
+
+// Возвращает индекс первого вхождения value или count, если его нет
+template <typename T>
+size_t SimdFind(const T* data, size_t count, const T& value)
+{
+    if constexpr (sizeof(T) == 1 && std::is_integral_v<T>)
+    {
+        // Однобайтовые типы ищет memchr — он уже векторизован в libc
+        unsigned char byte = 0;
+        std::memcpy(&byte, &value, 1);
+        const void* pos = std::memchr(data, byte, count);
+        return pos != nullptr ? static_cast<size_t>(static_cast<const T*>(pos) - data) : count;
+    }
+#if defined(__AVX2__)
+    else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+    {
+        const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(value));
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi32(chunk, needle));
+            if (mask != 0)
+                return i + static_cast<size_t>(__builtin_ctz(mask)) / 4;
+        }
+        for (; i < count; ++i)
+        {
+            if (data[i] == value)
+                return i;
+        }
+        return count;
+    }
+#endif
+    else
+    {
+        const T* pos = std::find(data, data + count, value);
+        return static_cast<size_t>(pos - data);
+    }
+}
+
+template <typename T>
+T SimdSum(const T* data, size_t count)
+{
+    static_assert(std::is_arithmetic_v<T>, "SimdSum определён только для арифметических T");
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, acc);
+        float sum = lanes[0] + lanes[1] + lanes[2] + lanes[3]
+                  + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+        for (; i < count; ++i)
+            sum += data[i];
+        return sum;
+    }
+    else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            acc = _mm256_add_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        T sum = static_cast<T>(lanes[0] + lanes[1] + lanes[2] + lanes[3]
+                             + lanes[4] + lanes[5] + lanes[6] + lanes[7]);
+        for (; i < count; ++i)
+            sum += data[i];
+        return sum;
+    }
+#endif
+
+    // Четыре независимых аккумулятора разрывают цепочку зависимостей,
+    // чтобы компилятор мог векторизовать и конвейеризовать цикл
+    T acc0{}, acc1{}, acc2{}, acc3{};
+    const size_t blocks = count / 4;
+    for (size_t b = 0; b != blocks; ++b)
+    {
+        acc0 += data[b * 4];
+        acc1 += data[b * 4 + 1];
+        acc2 += data[b * 4 + 2];
+        acc3 += data[b * 4 + 3];
+    }
+    for (size_t i = blocks * 4; i < count; ++i)
+        acc0 += data[i];
+    return acc0 + acc1 + acc2 + acc3;
+}
+
+// Минимум и максимум за один проход; диапазон не должен быть пустым
+template <typename T>
+std::pair<T, T> SimdMinMax(const T* data, size_t count)
+{
+    static_assert(std::is_arithmetic_v<T>, "SimdMinMax определён только для арифметических T");
+
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (count >= 8)
+        {
+            __m256 mins = _mm256_loadu_ps(data);
+            __m256 maxs = mins;
+            size_t i = 8;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256 chunk = _mm256_loadu_ps(data + i);
+                mins = _mm256_min_ps(mins, chunk);
+                maxs = _mm256_max_ps(maxs, chunk);
+            }
+
+            alignas(32) float lo[8], hi[8];
+            _mm256_store_ps(lo, mins);
+            _mm256_store_ps(hi, maxs);
+            float mn = lo[0], mx = hi[0];
+            for (int lane = 1; lane < 8; ++lane)
+            {
+                mn = std::min(mn, lo[lane]);
+                mx = std::max(mx, hi[lane]);
+            }
+            for (; i < count; ++i)
+            {
+                mn = std::min(mn, data[i]);
+                mx = std::max(mx, data[i]);
+            }
+            return { mn, mx };
+        }
+    }
+    else if constexpr (std::is_same_v<T, int32_t>)
+    {
+        if (count >= 8)
+        {
+            __m256i mins = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            __m256i maxs = mins;
+            size_t i = 8;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                mins = _mm256_min_epi32(mins, chunk);
+                maxs = _mm256_max_epi32(maxs, chunk);
+            }
+
+            alignas(32) int32_t lo[8], hi[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lo), mins);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(hi), maxs);
+            int32_t mn = lo[0], mx = hi[0];
+            for (int lane = 1; lane < 8; ++lane)
+            {
+                mn = std::min(mn, lo[lane]);
+                mx = std::max(mx, hi[lane]);
+            }
+            for (; i < count; ++i)
+            {
+                mn = std::min(mn, data[i]);
+                mx = std::max(mx, data[i]);
+            }
+            return { mn, mx };
+        }
+    }
+#endif
+
+    const auto [mn, mx] = std::minmax_element(data, data + count);
+    return { *mn, *mx };
+}
+
+// Предикат общего вида SIMD-ом не раскрутить; цикл написан без ветвлений,
+// чтобы компилятор мог свернуть его в маскированное сложение
+template <typename T, typename Pred>
+size_t SimdCountIf(const T* data, size_t count, Pred pred)
+{
+    size_t matched = 0;
+    for (size_t i = 0; i < count; ++i)
+        matched += pred(data[i]) ? 1 : 0;
+    return matched;
+}
+
+// Перегрузки ядер для Span — срез передаётся одним аргументом
+
+template <typename T>
+void SimdFill(Span<T> values, const T& value)
+{
+    SimdFill(values.Data(), values.Size(), value);
+}
+
+template <typename T>
+size_t SimdFind(Span<const T> values, const T& value)
+{
+    return SimdFind(values.Data(), values.Size(), value);
+}
+
+template <typename T>
+T SimdSum(Span<const T> values)
+{
+    return SimdSum(values.Data(), values.Size());
+}
+
+template <typename T>
+std::pair<T, T> SimdMinMax(Span<const T> values)
+{
+    return SimdMinMax(values.Data(), values.Size());
+}
+
+template <typename T, typename Pred>
+size_t SimdCountIf(Span<const T> values, Pred pred)
+{
+    return SimdCountIf(values.Data(), values.Size(), pred);
+}
+
+// Порог, с которого массовое копирование идёт потоковыми записями мимо
+// кэша: буферы такого размера всё равно не помещаются в L2, а прогон
+// их через иерархию кэшей вымывает рабочее множество соседних потоков
+inline constexpr size_t STREAMING_COPY_THRESHOLD = 4 * 1024 * 1024;
+
+// Копирование больших буферов с программной предвыборкой источника
+// и non-temporal записями в приёмник. В сценарии роста буфера новые
+// данные не будут прочитаны сразу, поэтому занимать ими кэш-линии
+// бессмысленно. Вне x86 с SSE2 остаётся обычный memcpy
+inline void StreamCopyBytes(void* dest, const void* source, size_t bytes) noexcept
+{
+#if defined(__SSE2__)
+    unsigned char* out = static_cast<unsigned char*>(dest);
+    const unsigned char* in = static_cast<const unsigned char*>(source);
+
+    // Потоковым записям нужен выровненный приёмник: голова до границы
+    // 16 байт копируется обычным способом
+    const size_t misalign = reinterpret_cast<uintptr_t>(out) & 15;
+    if (misalign != 0)
+    {
+        const size_t head = std::min(bytes, 16 - misalign);
+        std::memcpy(out, in, head);
+        out += head;
+        in += head;
+        bytes -= head;
+    }
+
+    while (bytes >= 64)
+    {
+        // Предвыборка на несколько итераций вперёд прячет латентность чтения
+        __builtin_prefetch(in + 512);
+
+        const __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+        const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 32));
+        const __m128i block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out), block0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 16), block1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 32), block2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(out + 48), block3);
+
+        in += 64;
+        out += 64;
+        bytes -= 64;
+    }
+
+    // Потоковые записи слабо упорядочены — барьер делает их видимыми
+    // до возврата из копирования
+    _mm_sfence();
+
+    if (bytes != 0)
+        std::memcpy(out, in, bytes);
+#else
+    std::memcpy(dest, source, bytes);
+#endif
+}
+
+// Константы xxHash64 — проверенные множители с хорошей лавинностью
+inline constexpr uint64_t HASH_PRIME_1 = 0x9E3779B185EBCA87ull;
+inline constexpr uint64_t HASH_PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+inline constexpr uint64_t HASH_PRIME_3 = 0x165667B19E3779F9ull;
+inline constexpr uint64_t HASH_PRIME_4 = 0x85EBCA77C2B2AE63ull;
+inline constexpr uint64_t HASH_PRIME_5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t RotateLeft64(uint64_t value, int shift) noexcept
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+inline uint64_t LoadWord64(const unsigned char* bytes) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+// Массовый хеш байтового буфера в духе xxHash64: блоки по 64 байта
+// перемешиваются в четыре независимых аккумулятора (по два слова на
+// аккумулятор за итерацию), что насыщает конвейер вместо побайтового
+// обхода. Хвост короче блока доедается словами и байтами
+inline uint64_t HashBytes(const void* data, size_t count) noexcept
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const unsigned char* const end = bytes + count;
+
+    auto mix = [](uint64_t acc, uint64_t word) noexcept
+    {
+        return RotateLeft64(acc + word * HASH_PRIME_2, 31) * HASH_PRIME_1;
+    };
+
+    uint64_t hash;
+    if (count >= 64)
+    {
+        uint64_t acc1 = HASH_PRIME_1 + HASH_PRIME_2;
+        uint64_t acc2 = HASH_PRIME_2;
+        uint64_t acc3 = 0;
+        uint64_t acc4 = 0 - HASH_PRIME_1;
+
+        do
+        {
+            acc1 = mix(acc1, LoadWord64(bytes));
+            acc2 = mix(acc2, LoadWord64(bytes + 8));
+            acc3 = mix(acc3, LoadWord64(bytes + 16));
+            acc4 = mix(acc4, LoadWord64(bytes + 24));
+            acc1 = mix(acc1, LoadWord64(bytes + 32));
+            acc2 = mix(acc2, LoadWord64(bytes + 40));
+            acc3 = mix(acc3, LoadWord64(bytes + 48));
+            acc4 = mix(acc4, LoadWord64(bytes + 56));
+            bytes += 64;
+        } while (static_cast<size_t>(end - bytes) >= 64);
+
+        hash = RotateLeft64(acc1, 1) + RotateLeft64(acc2, 7)
+             + RotateLeft64(acc3, 12) + RotateLeft64(acc4, 18);
+    }
+    else
+    {
+        hash = HASH_PRIME_5;
+    }
+
+    hash += count;
+
+    while (static_cast<size_t>(end - bytes) >= 8)
+    {
+        hash ^= mix(0, LoadWord64(bytes));
+        hash = RotateLeft64(hash, 27) * HASH_PRIME_1 + HASH_PRIME_4;
+        bytes += 8;
+    }
+
+    while (bytes != end)
+    {
+        hash ^= *bytes * HASH_PRIME_5;
+        hash = RotateLeft64(hash, 11) * HASH_PRIME_1;
+        ++bytes;
+    }
+
+    // Финальная лавина размазывает младшие байты по всему слову
+    hash ^= hash >> 33;
+    hash *= HASH_PRIME_2;
+    hash ^= hash >> 29;
+    hash *= HASH_PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// Вектор с оптимизацией малого буфера: до InlineCapacity элементов хранятся
+// внутри самого объекта без обращения к куче. При превышении инлайн-ёмкости
+// содержимое переезжает в RawMemory, и дальше контейнер ведёт себя как Vector
+template <typename T, size_t InlineCapacity>
+class SmallVector
+{
+    static_assert(InlineCapacity > 0, "Инлайн-буфер должен вмещать хотя бы один элемент");
+
+    // Перемещение контейнера переносит инлайн-элементы поштучно,
+    // поэтому его noexcept определяется перемещением T
+    static constexpr bool NOTHROW_MOVE = ASSUME_NOTHROW_OPERATIONS
+        || std::is_nothrow_move_constructible_v<T> || std::is_trivially_copyable_v<T>;
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() noexcept = default;
+
+    explicit SmallVector(size_t size)
+    {
+        Reserve(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    SmallVector(const SmallVector& other)
+    {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(NOTHROW_MOVE)
+    {
+        TakeContent(std::move(other));
+    }
+
+    SmallVector& operator=(const SmallVector& rhs)
+    {
+        if (this == &rhs)
+            return *this;
+
+        if (rhs.size_ > Capacity())
+        {
+            SmallVector rhs_copy(rhs);
+            std::destroy_n(Data(), size_);
+            size_ = 0;
+            TakeContent(std::move(rhs_copy));
+        }
+        else
+        {
+            size_t i = 0;
+            for (; i < size_ && i < rhs.size_; i++)
+                Data()[i] = rhs.Data()[i];
+
+            if (size_ < rhs.size_)
+                std::uninitialized_copy_n(rhs.Data() + i, rhs.size_ - i, Data() + i);
+            else // если у другого вектора было больше инициализированных элементов
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+
+            size_ = rhs.size_;
+        }
+
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& rhs) noexcept(NOTHROW_MOVE)
+    {
+        if (this != &rhs)
+        {
+            std::destroy_n(Data(), size_);
+            size_ = 0;
+            TakeContent(std::move(rhs));
+        }
+
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        std::destroy_n(Data(), size_);
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<SmallVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    iterator begin() noexcept { return Data(); }
+    iterator end() noexcept { return Data() + size_; }
+
+    const_iterator begin() const noexcept { return Data(); }
+    const_iterator end() const noexcept { return Data() + size_; }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return IsInline() ? InlineCapacity : heap_.Capacity();
+    }
+
+    bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    // Элементы хранятся в куче, а не в инлайн-буфере
+    bool Spilled() const noexcept
+    {
+        return !IsInline();
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity <= Capacity())
+            return;
+
+        RawMemory<T> new_data(new_capacity);
+        CopyDataRange(Data(), size_, new_data.GetAddress());
+        std::destroy_n(Data(), size_);
+        heap_.Swap(new_data);
+    }
+
+    void Resize(size_t new_size)
+    {
+        if (new_size > size_)
+        {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(Data() + size_, new_size - size_);
+        }
+        else
+        {
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
+
+    template <class Value>
+    void PushBack(Value&& value)
+    {
+        EmplaceBack(std::forward<Value>(value));
+    }
+
+    void PopBack() noexcept
+    {
+        if (!Empty())
+            Data()[--size_].~T();
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (size_ == Capacity())
+        {
+            RawMemory<T> new_data(2 * Capacity());
+            new (new_data.GetAddress() + size_) T(std::forward<Args>(args)...);
+
+            CopyDataRange(Data(), size_, new_data.GetAddress());
+            std::destroy_n(Data(), size_);
+            heap_.Swap(new_data);
+        }
+        else
+        {
+            new (Data() + size_) T(std::forward<Args>(args)...);
+        }
+
+        ++size_;
+        return Data()[size_ - 1];
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args)
+    {
+        size_t value_pos = pos - begin();
+
+        if (size_ == Capacity())
+        {
+            RawMemory<T> new_data(2 * Capacity());
+
+            // Вставляем элемент в новую область
+            new (new_data.GetAddress() + value_pos) T(std::forward<Args>(args)...);
+
+            // Добавляем значения до pos и от pos до end в новую область памяти
+            CopyDataRange(Data(), value_pos, new_data.GetAddress());
+            CopyDataRange(Data() + value_pos, size_ - value_pos, new_data.GetAddress() + value_pos + 1);
+
+            std::destroy_n(Data(), size_);
+            heap_.Swap(new_data);
+        }
+        else if (pos == end())
+        {
+            new (end()) T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // Значение строится до сдвига: args могут ссылаться на сдвигаемый элемент
+            T tmp(std::forward<Args>(args)...);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                ShiftDataRange(Data() + value_pos, size_ - value_pos, Data() + value_pos + 1);
+            }
+            else
+            {
+                new (end()) T(std::forward<T>(*(end() - 1)));
+                std::move_backward(Data() + value_pos, end() - 1, end());
+            }
+            Data()[value_pos] = std::move(tmp);
+        }
+
+        ++size_;
+        return Data() + value_pos;
+    }
+
+    template <class Value>
+    iterator Insert(const_iterator pos, Value&& value)
+    {
+        return Emplace(pos, std::forward<Value>(value));
+    }
+
+    iterator Erase(const_iterator pos) noexcept
+    {
+        assert(!Empty());
+        size_t value_pos = pos - begin();
+        ShiftDataRange(Data() + value_pos + 1, size_ - value_pos - 1, Data() + value_pos);
+        PopBack();
+        return Data() + value_pos;
+    }
+
+private:
+    bool IsInline() const noexcept
+    {
+        return heap_.GetAddress() == nullptr;
+    }
+
+    T* Data() noexcept
+    {
+        return IsInline() ? reinterpret_cast<T*>(inline_buffer_) : heap_.GetAddress();
+    }
+
+    const T* Data() const noexcept
+    {
+        return const_cast<SmallVector&>(*this).Data();
+    }
+
+    // Забирает содержимое other: буфер кучи перехватывается указателем,
+    // инлайн-элементы переносятся поштучно. Источник угасает, откат
+    // не нужен — элементы всегда перемещаются, даже если move-конструктор
+    // T формально не noexcept
+    void TakeContent(SmallVector&& other) noexcept(NOTHROW_MOVE)
+    {
+        assert(size_ == 0);
+
+        if (other.IsInline())
+        {
+            if constexpr (IsTriviallyRelocatable_v<T>)
+            {
+                RelocateDataRange(other.Data(), other.size_, Data());
+            }
+            else
+            {
+                std::uninitialized_move_n(other.Data(), other.size_, Data());
+                std::destroy_n(other.Data(), other.size_);
+            }
+        }
+        else
+        {
+            heap_.Swap(other.heap_);
+        }
+
+        size_ = std::exchange(other.size_, 0);
+    }
+
+private:
+    alignas(T) unsigned char inline_buffer_[sizeof(T) * InlineCapacity];
+    RawMemory<T> heap_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+// Контейнер с размещением "структура массивов": по отдельному RawMemory
+// на каждое поле вместо одного массива структур. Горячие ядра, которым
+// нужна часть полей, идут плотно по одному массиву — кэш-линии не
+// разбавлены чужими полями, и автовекторизация получает сплошные данные.
+// Логика роста и переноса — та же, что в EmplaceBack у Vector,
+// примененная к каждому полю
+template <typename... Ts>
+class SoAVector
+{
+    static_assert(sizeof...(Ts) > 0, "SoAVector требует хотя бы одно поле");
+
+    using Storage = std::tuple<RawMemory<Ts>...>;
+
+    template <size_t I>
+    using Field_t = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+public:
+    SoAVector() = default;
+
+    explicit SoAVector(size_t size)
+    {
+        Reserve(size);
+        ConstructTail<0>(size);
+        size_ = size;
+    }
+
+    SoAVector(const SoAVector& other)
+    {
+        Reserve(other.size_);
+        CopyTail<0>(other);
+        size_ = other.size_;
+    }
+
+    SoAVector(SoAVector&& other) noexcept
+    {
+        Swap(other);
+    }
+
+    SoAVector& operator=(const SoAVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            SoAVector copy(rhs);
+            Swap(copy);
+        }
+        return *this;
+    }
+
+    SoAVector& operator=(SoAVector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            SoAVector moved(std::move(rhs));
+            Swap(moved);
+        }
+        return *this;
+    }
+
+    ~SoAVector()
+    {
+        DestroyRange(0, size_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return std::get<0>(data_).Capacity();
+    }
+
+    bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    // Плотный массив одного поля — вход для горячих ядер
+    template <size_t I>
+    Field_t<I>* Field() noexcept
+    {
+        return std::get<I>(data_).GetAddress();
+    }
+
+    template <size_t I>
+    const Field_t<I>* Field() const noexcept
+    {
+        return std::get<I>(data_).GetAddress();
+    }
+
+    // Все поля одного элемента кортежем ссылок
+    std::tuple<Ts&...> operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return std::apply(
+            [index](auto&... fields) { return std::tie(fields[index]...); }, data_);
+    }
+
+    std::tuple<const Ts&...> operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return std::apply(
+            [index](const auto&... fields) { return std::tie(fields[index]...); }, data_);
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity > Capacity())
+            Relocate(new_capacity);
+    }
+
+    void Resize(size_t new_size)
+    {
+        if (new_size < size_)
+        {
+            DestroyRange(new_size, size_);
+            size_ = new_size;
+            return;
+        }
+
+        Reserve(new_size);
+        ConstructTail<0>(new_size);
+        size_ = new_size;
+    }
+
+    // Принимает по одному значению на поле
+    template <typename... Us>
+    void EmplaceBack(Us&&... values)
+    {
+        static_assert(sizeof...(Us) == sizeof...(Ts),
+                      "EmplaceBack ожидает по одному значению на каждое поле");
+
+        if (size_ == Capacity())
+            Relocate(DoubleGrowth::Next(Capacity()));
+
+        EmplaceFields<0>(std::forward<Us>(values)...);
+        ++size_;
+    }
+
+    void PushBack(const Ts&... values)
+    {
+        EmplaceBack(values...);
+    }
+
+    void PopBack() noexcept
+    {
+        assert(!Empty());
+        --size_;
+        std::apply(
+            [this](auto&... fields) { (std::destroy_at(fields + size_), ...); }, data_);
+    }
+
+    void Swap(SoAVector& other) noexcept
+    {
+        std::apply(
+            [&other](auto&... fields)
+            {
+                std::apply([&fields...](auto&... other_fields)
+                           { (fields.Swap(other_fields), ...); },
+                           other.data_);
+            },
+            data_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    // Переезд всех полей в буферы новой ёмкости. Поля переносятся по
+    // очереди; если перенос очередного бросил, уже перенесённые
+    // разрушаются на раскрутке — как в пути роста у EmplaceBack
+    void Relocate(size_t new_capacity)
+    {
+        Storage fresh{ RawMemory<Ts>(new_capacity)... };
+
+        RelocateFields<0>(fresh);
+
+        DestroyRange(0, size_);
+        std::apply(
+            [this](auto&... fresh_fields)
+            {
+                std::apply([&fresh_fields...](auto&... fields)
+                           { (fields.Swap(fresh_fields), ...); },
+                           data_);
+            },
+            fresh);
+    }
+
+    template <size_t I>
+    void RelocateFields(Storage& fresh)
+    {
+        if constexpr (I < sizeof...(Ts))
+        {
+            CopyDataRange(std::get<I>(data_).GetAddress(), size_,
+                          std::get<I>(fresh).GetAddress());
+            try
+            {
+                RelocateFields<I + 1>(fresh);
+            }
+            catch (...)
+            {
+                std::destroy_n(std::get<I>(fresh).GetAddress(), size_);
+                throw;
+            }
+        }
+    }
+
+    // Достраивает элементы [size_, new_size) значениями по умолчанию
+    template <size_t I>
+    void ConstructTail(size_t new_size)
+    {
+        if constexpr (I < sizeof...(Ts))
+        {
+            ValueConstructRange(std::get<I>(data_).GetAddress() + size_, new_size - size_);
+            try
+            {
+                ConstructTail<I + 1>(new_size);
+            }
+            catch (...)
+            {
+                std::destroy_n(std::get<I>(data_).GetAddress() + size_, new_size - size_);
+                throw;
+            }
+        }
+    }
+
+    template <size_t I>
+    void CopyTail(const SoAVector& other)
+    {
+        if constexpr (I < sizeof...(Ts))
+        {
+            std::uninitialized_copy_n(std::get<I>(other.data_).GetAddress(), other.size_,
+                                      std::get<I>(data_).GetAddress());
+            try
+            {
+                CopyTail<I + 1>(other);
+            }
+            catch (...)
+            {
+                std::destroy_n(std::get<I>(data_).GetAddress(), other.size_);
+                throw;
+            }
+        }
+    }
+
+    template <size_t I, typename U, typename... Us>
+    void EmplaceFields(U&& value, Us&&... rest)
+    {
+        std::construct_at(std::get<I>(data_).GetAddress() + size_, std::forward<U>(value));
+        if constexpr (sizeof...(Us) > 0)
+        {
+            try
+            {
+                EmplaceFields<I + 1>(std::forward<Us>(rest)...);
+            }
+            catch (...)
+            {
+                std::destroy_at(std::get<I>(data_).GetAddress() + size_);
+                throw;
+            }
+        }
+    }
+
+    void DestroyRange(size_t from, size_t to) noexcept
+    {
+        std::apply(
+            [from, to](auto&... fields)
+            { (std::destroy_n(fields.GetAddress() + from, to - from), ...); }, data_);
+    }
+
+private:
+    Storage data_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+// Отсортированный вектор — плоская замена map/set на непрерывном буфере:
+// бинарный поиск по кэш-дружелюбной памяти вместо прыжков по узлам дерева.
+// Одиночная вставка наследует O(N)-сдвиг Emplace, поэтому массовые
+// добавления идут через InsertSorted: партия сортируется отдельно
+// и вливается одним проходом слияния — не более одного перемещения
+// на элемент вместо полного сдвига хвоста на каждый ключ
+template <typename T, typename Compare = std::less<T>>
+class SortedVector
+{
+public:
+    // Наружу отдаются только константные итераторы:
+    // запись мимо адаптера сломала бы инвариант сортированности
+    using const_iterator = typename Vector<T>::const_iterator;
+    using iterator = const_iterator;
+
+    SortedVector() = default;
+
+    explicit SortedVector(Compare compare)
+        : compare_(std::move(compare))
+    {
+    }
+
+    template <typename InputIt>
+    SortedVector(InputIt first, InputIt last, Compare compare = Compare())
+        : compare_(std::move(compare))
+    {
+        data_.AppendRange(first, last);
+        std::sort(data_.begin(), data_.end(), compare_);
+    }
+
+    const_iterator begin() const noexcept { return data_.begin(); }
+    const_iterator end() const noexcept { return data_.end(); }
+
+    const_iterator cbegin() const noexcept { return data_.cbegin(); }
+    const_iterator cend() const noexcept { return data_.cend(); }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return data_[index];
+    }
+
+    size_t Size() const noexcept
+    {
+        return data_.Size();
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return data_.Capacity();
+    }
+
+    bool Empty() const noexcept
+    {
+        return data_.Empty();
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        data_.Reserve(new_capacity);
+    }
+
+    void Clear() noexcept
+    {
+        data_.Clear();
+    }
+
+    // Доступ к несущему вектору — для массовых алгоритмов и сериализации
+    const Vector<T>& Base() const noexcept
+    {
+        return data_;
+    }
+
+    const_iterator LowerBound(const T& value) const
+    {
+        return std::lower_bound(begin(), end(), value, compare_);
+    }
+
+    const_iterator UpperBound(const T& value) const
+    {
+        return std::upper_bound(begin(), end(), value, compare_);
+    }
+
+    const_iterator Find(const T& value) const
+    {
+        const_iterator pos = LowerBound(value);
+        return pos != end() && !compare_(value, *pos) ? pos : end();
+    }
+
+    bool Contains(const T& value) const
+    {
+        return Find(value) != end();
+    }
+
+    size_t Count(const T& value) const
+    {
+        const auto [first, last] = std::equal_range(begin(), end(), value, compare_);
+        return static_cast<size_t>(last - first);
+    }
+
+    // Одиночная вставка: бинарный поиск позиции плюс O(N)-сдвиг хвоста.
+    // Для партий ключей используйте InsertSorted
+    template <class Value>
+    const_iterator Insert(Value&& value)
+    {
+        const_iterator pos = UpperBound(value);
+        return data_.Insert(pos, std::forward<Value>(value));
+    }
+
+    // Массовая вставка: партия сортируется отдельно, и оба отсортированных
+    // диапазона сливаются одним проходом в свежий буфер — каждый элемент
+    // переезжает не более одного раза вместо полного сдвига хвоста
+    // на каждый ключ. Слияние в сырую память не требует от T
+    // конструктора по умолчанию; равные ключи встают после существующих,
+    // как и при одиночном Insert через UpperBound
+    template <typename InputIt>
+    void InsertSorted(InputIt first, InputIt last)
+    {
+        Vector<T> batch;
+        batch.AppendRange(first, last);
+        if (batch.Empty())
+            return;
+
+        std::sort(batch.begin(), batch.end(), compare_);
+
+        Vector<T> merged;
+        merged.Reserve(data_.Size() + batch.Size());
+
+        size_t source = 0;
+        size_t incoming = 0;
+        while (source != data_.Size() && incoming != batch.Size())
+        {
+            if (compare_(batch[incoming], data_[source]))
+                merged.UncheckedEmplaceBack(std::move(batch[incoming++]));
+            else
+                merged.UncheckedEmplaceBack(std::move(data_[source++]));
+        }
+        while (source != data_.Size())
+            merged.UncheckedEmplaceBack(std::move(data_[source++]));
+        while (incoming != batch.Size())
+            merged.UncheckedEmplaceBack(std::move(batch[incoming++]));
+
+        data_.Swap(merged);
+    }
+
+    void InsertSorted(Span<const T> values)
+    {
+        InsertSorted(values.begin(), values.end());
+    }
+
+    const_iterator Erase(const_iterator pos) noexcept
+    {
+        return data_.Erase(pos);
+    }
+
+    // Удаляет все элементы, эквивалентные value; возвращает их число
+    size_t Erase(const T& value) noexcept
+    {
+        const auto [first, last] = std::equal_range(begin(), end(), value, compare_);
+        const size_t removed = static_cast<size_t>(last - first);
+        if (removed != 0)
+            data_.Erase(first, last);
+        return removed;
+    }
+
+private:
+    Vector<T> data_;
+    Compare compare_;
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+// Невладеющий взгляд на непрерывный диапазон: указатель и длина.
+// Позволяет передавать срез буфера между стадиями конвейера без
+// копирования и без пар (итератор, размер) в каждой сигнатуре
+template <typename T>
+class Span
+{
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr Span() = default;
+
+    constexpr Span(T* data, size_t count) noexcept
+        : data_(data)
+        , size_(count)
+    {
+    }
+
+    constexpr Span(T* first, T* last) noexcept
+        : data_(first)
+        , size_(static_cast<size_t>(last - first))
+    {
+    }
+
+    // Неявное сужение Span<T> -> Span<const T>
+    constexpr operator Span<const T>() const noexcept requires (!std::is_const_v<T>)
+    {
+        return Span<const T>(data_, size_);
+    }
+
+    constexpr T& operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    constexpr T* Data() const noexcept
+    {
+        return data_;
+    }
+
+    constexpr size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr bool Empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    constexpr const_iterator cbegin() const noexcept { return data_; }
+    constexpr const_iterator cend() const noexcept { return data_ + size_; }
+
+    constexpr T& Front() const noexcept
+    {
+        assert(!Empty());
+        return data_[0];
+    }
+
+    constexpr T& Back() const noexcept
+    {
+        assert(!Empty());
+        return data_[size_ - 1];
+    }
+
+    // Срез из count элементов начиная с offset; без count — до конца
+    constexpr Span Subspan(size_t offset, size_t count) const noexcept
+    {
+        assert(offset + count <= size_);
+        return Span(data_ + offset, count);
+    }
+
+    constexpr Span Subspan(size_t offset) const noexcept
+    {
+        assert(offset <= size_);
+        return Span(data_ + offset, size_ - offset);
+    }
+
+    constexpr Span First(size_t count) const noexcept
+    {
+        assert(count <= size_);
+        return Span(data_, count);
+    }
+
+    constexpr Span Last(size_t count) const noexcept
+    {
+        assert(count <= size_);
+        return Span(data_ + size_ - count, count);
+    }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
@@ -2,95 +2,360 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <new>
 #include <utility>
 #include <memory>
 #include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+
+#include "deferred_reclaimer.h"
+#include "simd_algorithms.h"
+
+// Проверки на горячих путях доступа. Обычная сборка — assert: в отладке
+// ловит выход за границы, с -DNDEBUG исчезает. Сборка
+// с -DVECTOR_ASSUME_ASSERTS (диагностические RelWithDebInfo-сборки,
+// где NDEBUG не определён) превращает проверку в подсказку оптимизатору:
+// условие объявляется истинным, ветка проверки не генерируется, а
+// компилятор использует инвариант для устранения лишних проверок выше
+// по стеку. Нарушение условия в этом режиме — UB, как и с -DNDEBUG
+#ifdef VECTOR_ASSUME_ASSERTS
+#if defined(_MSC_VER)
+#define VECTOR_VERIFY(condition) __assume(condition)
+#else
+#define VECTOR_VERIFY(condition) \
+    do                           \
+    {                            \
+        if (!(condition))        \
+            __builtin_unreachable(); \
+    } while (false)
+#endif
+#else
+#define VECTOR_VERIFY(condition) assert(condition)
+#endif
+
+// Принудительный инлайнинг микро-доступов: одиночный load не должен
+// превращаться в call из-за настроения inliner-а в -O1/RelWithDebInfo
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_ALWAYS_INLINE [[gnu::always_inline]] inline
+#elif defined(_MSC_VER)
+#define VECTOR_ALWAYS_INLINE __forceinline
+#else
+#define VECTOR_ALWAYS_INLINE inline
+#endif
+
+// Аллокатор по умолчанию: сырая память из глобальных operator new/delete.
+// В constant evaluation operator new недоступен, поэтому компиляционные
+// вычисления идут через std::allocator (constexpr начиная с C++20)
+template <typename T>
+struct NewDeleteAllocator
+{
+    constexpr T* Allocate(size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+
+        if (std::is_constant_evaluated())
+            return std::allocator<T>{}.allocate(n);
+
+        return static_cast<T*>(operator new(n * sizeof(T)));
+    }
 
+    constexpr void Deallocate(T* buf, size_t n) noexcept
+    {
+        if (buf == nullptr)
+            return;
+
+        if (std::is_constant_evaluated())
+            std::allocator<T>{}.deallocate(buf, n);
+        else
+            operator delete(buf);
+    }
+};
+
+// Аллокатор поверх malloc/free: в отличие от operator new умеет
+// расширять блок на месте через realloc. Для тривиально релоцируемых T
+// рост буфера через него часто обходится вообще без копирования —
+// аллокатор достраивает страницы к существующему блоку
 template <typename T>
+struct MallocAllocator
+{
+    T* Allocate(size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+
+        void* block = std::malloc(n * sizeof(T));
+        if (block == nullptr)
+            throw std::bad_alloc();
+        return static_cast<T*>(block);
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept
+    {
+        std::free(buf);
+    }
+
+    // Блок может переехать — это допустимо только для тривиально
+    // релоцируемых T, что проверяет вызывающая сторона
+    T* Reallocate(T* buf, size_t /*old_n*/, size_t new_n)
+    {
+        void* block = std::realloc(static_cast<void*>(buf), new_n * sizeof(T));
+        if (block == nullptr && new_n != 0)
+            throw std::bad_alloc();
+        return static_cast<T*>(block);
+    }
+};
+
+// Тривиальная релоцируемость: перемещение плюс разрушение источника
+// эквивалентны memcpy. Верно для всех тривиально копируемых типов,
+// а для своих типов (обёртки над хэндлами, указателями, дескрипторами)
+// специализируется пользователем:
+//
+//     template <> struct IsTriviallyRelocatable<MyHandle> : std::true_type {};
+template <typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+template <typename T>
+inline constexpr bool IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
+
+// Аллокатор умеет расширять блок на месте в стиле realloc
+template <typename Alloc, typename T>
+concept ReallocatingAllocator = requires(Alloc alloc, T* buffer, size_t n)
+{
+    { alloc.Reallocate(buffer, n, n) } -> std::convertible_to<T*>;
+};
+
+// Режим "мира без исключений": сборка с -DVECTOR_ASSUME_NOTHROW обещает,
+// что конструкторы элементов не бросают (сервисы на -fno-exceptions).
+// Тогда строгая гарантия не требует подстраховки копированием —
+// переезды всегда перемещают, даже если move-конструктор формально
+// не помечен noexcept
+#ifdef VECTOR_ASSUME_NOTHROW
+inline constexpr bool ASSUME_NOTHROW_OPERATIONS = true;
+#else
+inline constexpr bool ASSUME_NOTHROW_OPERATIONS = false;
+#endif
+
+// Метки порядка байтов в заголовке сериализованного вектора
+inline constexpr uint8_t VECTOR_BLOB_LITTLE_ENDIAN = 1;
+inline constexpr uint8_t VECTOR_BLOB_BIG_ENDIAN = 2;
+
+inline constexpr uint8_t NativeEndiannessTag() noexcept
+{
+    return std::endian::native == std::endian::little
+        ? VECTOR_BLOB_LITTLE_ENDIAN : VECTOR_BLOB_BIG_ENDIAN;
+}
+
+// Опциональная телеметрия аллокаций: счётчики и колбэк на реаллокации.
+// Включается сборкой с -DVECTOR_ENABLE_TELEMETRY; без него хуки ниже —
+// пустые inline-функции и кода не порождают
+#ifdef VECTOR_ENABLE_TELEMETRY
+
+// Описание одного события реаллокации — передаётся в колбэк,
+// чтобы экспортёр метрик видел и размер, и цену переезда
+struct ReallocationEvent
+{
+    size_t element_size = 0;
+    size_t old_capacity = 0;
+    size_t new_capacity = 0;
+    size_t elements_moved = 0;
+};
+
+using ReallocationCallback = void (*)(const ReallocationEvent&);
+
+struct VectorTelemetry
+{
+    std::atomic<size_t> allocation_count{ 0 };
+    std::atomic<size_t> deallocation_count{ 0 };
+    // Текущая суммарная ёмкость живых буферов в байтах; разница с реально
+    // занятым объёмом — это slack, из-за которого растёт RSS
+    std::atomic<size_t> bytes_reserved{ 0 };
+    std::atomic<size_t> reallocation_count{ 0 };
+    std::atomic<size_t> elements_moved{ 0 };
+    std::atomic<ReallocationCallback> on_reallocation{ nullptr };
+
+    void Reset() noexcept
+    {
+        allocation_count.store(0, std::memory_order_relaxed);
+        deallocation_count.store(0, std::memory_order_relaxed);
+        bytes_reserved.store(0, std::memory_order_relaxed);
+        reallocation_count.store(0, std::memory_order_relaxed);
+        elements_moved.store(0, std::memory_order_relaxed);
+    }
+};
+
+inline VectorTelemetry& GetVectorTelemetry() noexcept
+{
+    static VectorTelemetry stats;
+    return stats;
+}
+
+#endif  // VECTOR_ENABLE_TELEMETRY
+
+template <typename T>
+constexpr void NotifyBufferAllocated([[maybe_unused]] size_t capacity) noexcept
+{
+#ifdef VECTOR_ENABLE_TELEMETRY
+    if (!std::is_constant_evaluated() && capacity != 0)
+    {
+        VectorTelemetry& stats = GetVectorTelemetry();
+        stats.allocation_count.fetch_add(1, std::memory_order_relaxed);
+        stats.bytes_reserved.fetch_add(capacity * sizeof(T), std::memory_order_relaxed);
+    }
+#endif
+}
+
+template <typename T>
+constexpr void NotifyBufferFreed([[maybe_unused]] size_t capacity) noexcept
+{
+#ifdef VECTOR_ENABLE_TELEMETRY
+    if (!std::is_constant_evaluated() && capacity != 0)
+    {
+        VectorTelemetry& stats = GetVectorTelemetry();
+        stats.deallocation_count.fetch_add(1, std::memory_order_relaxed);
+        stats.bytes_reserved.fetch_sub(capacity * sizeof(T), std::memory_order_relaxed);
+    }
+#endif
+}
+
+template <typename T>
+constexpr void NotifyReallocation([[maybe_unused]] size_t old_capacity,
+                                  [[maybe_unused]] size_t new_capacity,
+                                  [[maybe_unused]] size_t elements_moved) noexcept
+{
+#ifdef VECTOR_ENABLE_TELEMETRY
+    if (!std::is_constant_evaluated())
+    {
+        VectorTelemetry& stats = GetVectorTelemetry();
+        stats.reallocation_count.fetch_add(1, std::memory_order_relaxed);
+        stats.elements_moved.fetch_add(elements_moved, std::memory_order_relaxed);
+
+        if (ReallocationCallback callback = stats.on_reallocation.load(std::memory_order_acquire))
+        {
+            ReallocationEvent event;
+            event.element_size = sizeof(T);
+            event.old_capacity = old_capacity;
+            event.new_capacity = new_capacity;
+            event.elements_moved = elements_moved;
+            callback(event);
+        }
+    }
+#endif
+}
+
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
 class RawMemory
 {
 public:
-    RawMemory() = default;
+    constexpr RawMemory() = default;
+
+    constexpr explicit RawMemory(const Alloc& alloc) noexcept
+        : alloc_(alloc)
+    {
+    }
 
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
+    constexpr explicit RawMemory(size_t capacity, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , buffer_(alloc_.Allocate(capacity))
         , capacity_(capacity)
     {
+        NotifyBufferAllocated<T>(capacity_);
     }
 
     RawMemory(const RawMemory& other) = delete;
     RawMemory& operator=(const RawMemory&) = delete;
 
-    RawMemory(RawMemory&& other) noexcept
-        : buffer_(std::exchange(other.buffer_, nullptr))
+    constexpr RawMemory(RawMemory&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , buffer_(std::exchange(other.buffer_, nullptr))
         , capacity_(std::exchange(other.capacity_, 0))
     {
     }
 
-    ~RawMemory()
+    constexpr ~RawMemory()
     {
-        Deallocate(buffer_);
+        NotifyBufferFreed<T>(capacity_);
+        alloc_.Deallocate(buffer_, capacity_);
     }
 
-    T* operator+(size_t offset) noexcept
+    VECTOR_ALWAYS_INLINE constexpr T* operator+(size_t offset) noexcept
     {
         // Разрешается получать адрес ячейки памяти, следующей за последним элементом массива
-        assert(offset <= capacity_);
+        VECTOR_VERIFY(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T* operator+(size_t offset) const noexcept
+    VECTOR_ALWAYS_INLINE constexpr const T* operator+(size_t offset) const noexcept
     {
-        return const_cast<RawMemory&>(*this) + offset;
+        VECTOR_VERIFY(offset <= capacity_);
+        return buffer_ + offset;
     }
 
-    const T& operator[](size_t index) const noexcept
+    VECTOR_ALWAYS_INLINE constexpr const T& operator[](size_t index) const noexcept
     {
-        return const_cast<RawMemory&>(*this)[index];
+        VECTOR_VERIFY(index <= capacity_);
+        return buffer_[index];
     }
 
-    T& operator[](size_t index) noexcept
+    VECTOR_ALWAYS_INLINE constexpr T& operator[](size_t index) noexcept
     {
-        assert(index <= capacity_);
+        VECTOR_VERIFY(index <= capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory& other) noexcept
+    // Перевыделение блока в стиле realloc — только для аллокаторов
+    // с Reallocate; контроль релоцируемости T лежит на вызывающем
+    void Reallocate(size_t new_capacity)
+    {
+        NotifyBufferFreed<T>(capacity_);
+        buffer_ = alloc_.Reallocate(buffer_, capacity_, new_capacity);
+        capacity_ = new_capacity;
+        NotifyBufferAllocated<T>(capacity_);
+    }
+
+    constexpr void Swap(RawMemory& other) noexcept
     {
+        std::swap(alloc_, other.alloc_);
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
-    const T* GetAddress() const noexcept
+    constexpr const T* GetAddress() const noexcept
     {
         return buffer_;
     }
 
-    T* GetAddress() noexcept
+    constexpr T* GetAddress() noexcept
     {
         return buffer_;
     }
 
-    size_t Capacity() const
+    constexpr size_t Capacity() const
     {
         return capacity_;
     }
 
-private:
-    // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T* Allocate(size_t n)
+    constexpr const Alloc& GetAllocator() const noexcept
     {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
-    }
-
-    // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T* buf) noexcept
-    {
-        operator delete(buf);
+        return alloc_;
     }
 
 private:
+    Alloc alloc_;
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
@@ -98,36 +363,298 @@ private:
 
 
 
+// Переносит count элементов из source в неинициализированную область dest,
+// выбирая между перемещением и копированием в зависимости от свойств T.
+// Для тривиально копируемых типов диапазон переносится одним memcpy:
+// компилятор не всегда сворачивает поэлементный цикл в векторизованную копию
+template <typename T>
+constexpr void CopyDataRange(T* source, size_t count, T* dest)
+{
+    // В constant evaluation memcpy и std::uninitialized_* недоступны —
+    // элементы строятся циклом через std::construct_at
+    if (std::is_constant_evaluated())
+    {
+        for (size_t i = 0; i != count; ++i)
+            std::construct_at(dest + i, std::move(source[i]));
+        return;
+    }
+
+    // constexpr оператор if будет вычислен во время компиляции
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        // Гигантские переезды идут потоковыми записями мимо кэша:
+        // при росте буфера новые данные не читаются тут же, и прогонять
+        // их через L2/L3 — значит вымывать чужое рабочее множество
+        if (count * sizeof(T) >= STREAMING_COPY_THRESHOLD)
+            StreamCopyBytes(dest, source, count * sizeof(T));
+        else if (count != 0)
+            std::memcpy(dest, source, count * sizeof(T));
+    }
+    else if constexpr (ASSUME_NOTHROW_OPERATIONS || std::is_nothrow_move_constructible_v<T>
+                       || !std::is_copy_constructible_v<T>)
+    {
+        // В мире без исключений подстраховка копированием не нужна:
+        // перемещение не может бросить посреди переезда
+        std::uninitialized_move_n(source, count, dest);
+    }
+    else
+    {
+        std::uninitialized_copy_n(source, count, dest);
+    }
+}
+
+// Переносит count элементов в новый буфер и освобождает источник:
+// перемещение плюс разрушение одной операцией. Для тривиально
+// релоцируемых T это один memcpy без вызова конструкторов и деструкторов
 template <typename T>
+constexpr void RelocateDataRange(T* source, size_t count, T* dest)
+{
+    if (std::is_constant_evaluated())
+    {
+        for (size_t i = 0; i != count; ++i)
+        {
+            std::construct_at(dest + i, std::move(source[i]));
+            std::destroy_at(source + i);
+        }
+        return;
+    }
+
+    if constexpr (IsTriviallyRelocatable_v<T>)
+    {
+        const size_t bytes = count * sizeof(T);
+        if (bytes >= STREAMING_COPY_THRESHOLD)
+            StreamCopyBytes(dest, source, bytes);
+        else if (count != 0)
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), bytes);
+    }
+    else
+    {
+        CopyDataRange(source, count, dest);
+        std::destroy_n(source, count);
+    }
+}
+
+// Конструирует count элементов по умолчанию в сырой памяти; compile-time
+// аналог std::uninitialized_value_construct_n
+template <typename T>
+constexpr void ValueConstructRange(T* dest, size_t count)
+{
+    if (std::is_constant_evaluated())
+    {
+        for (size_t i = 0; i != count; ++i)
+            std::construct_at(dest + i);
+        return;
+    }
+
+    std::uninitialized_value_construct_n(dest, count);
+}
+
+// Копирует count элементов из first в сырую память; compile-time аналог
+// std::uninitialized_copy_n
+template <typename InputIt, typename T>
+constexpr void UninitializedCopyRange(InputIt first, size_t count, T* dest)
+{
+    if (std::is_constant_evaluated())
+    {
+        for (size_t i = 0; i != count; ++i, ++first)
+            std::construct_at(dest + i, *first);
+        return;
+    }
+
+    std::uninitialized_copy_n(first, count, dest);
+}
+
+// Сдвигает count элементов в пределах одного буфера (области могут
+// пересекаться): memmove для тривиально копируемых типов, иначе поэлементно.
+// Диапазон [source, source + count) должен быть уже инициализирован,
+// как и место назначения
+template <typename T>
+constexpr void ShiftDataRange(T* source, size_t count, T* dest)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            if (count != 0)
+                std::memmove(dest, source, count * sizeof(T));
+            return;
+        }
+    }
+
+    if (dest < source)
+        std::move(source, source + count, dest);
+    else
+        std::move_backward(source, source + count, dest + count);
+}
+
+// Минимальная доля работы на один поток при параллельной инициализации:
+// на небольших объёмах запуск потоков дороже самой конструкции
+inline constexpr size_t PARALLEL_INIT_GRAIN = 64 * 1024;
+
+inline size_t ParallelWorkerCount(size_t count) noexcept
+{
+    const size_t hw = std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::min(hw, std::max<size_t>(1, count / PARALLEL_INIT_GRAIN));
+}
+
+// Конструирует count элементов по умолчанию, разбивая диапазон между потоками.
+// Гарантия как у однопоточного варианта: при исключении в любом из потоков
+// все успевшие сконструироваться элементы разрушаются и исключение летит дальше
+template <typename T>
+void ParallelValueConstruct(T* dest, size_t count)
+{
+    const size_t num_threads = ParallelWorkerCount(count);
+    if (num_threads < 2)
+    {
+        std::uninitialized_value_construct_n(dest, count);
+        return;
+    }
+
+    const size_t chunk = (count + num_threads - 1) / num_threads;
+    auto workers = std::make_unique<std::thread[]>(num_threads);
+    auto done = std::make_unique<bool[]>(num_threads);
+    auto errors = std::make_unique<std::exception_ptr[]>(num_threads);
+
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        const size_t from = t * chunk;
+        const size_t to = std::min(count, from + chunk);
+        workers[t] = std::thread([dest, from, to, t, done_flags = done.get(), errs = errors.get()]
+        {
+            try
+            {
+                // При исключении частично построенная доля уже разрушена
+                std::uninitialized_value_construct_n(dest + from, to - from);
+                done_flags[t] = true;
+            }
+            catch (...)
+            {
+                errs[t] = std::current_exception();
+            }
+        });
+    }
+
+    for (size_t t = 0; t < num_threads; ++t)
+        workers[t].join();
+
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        if (errors[t])
+        {
+            // Разрушаем доли, построенные другими потоками целиком
+            for (size_t i = 0; i < num_threads; ++i)
+            {
+                if (done[i])
+                    std::destroy_n(dest + i * chunk, std::min(count, (i + 1) * chunk) - i * chunk);
+            }
+            std::rethrow_exception(errors[t]);
+        }
+    }
+}
+
+// Параллельное разрушение count элементов; для тривиально разрушаемых T
+// сводится к no-op без запуска потоков
+template <typename T>
+void ParallelDestroy(T* first, size_t count) noexcept
+{
+    if constexpr (std::is_trivially_destructible_v<T>)
+    {
+        (void)first;
+        (void)count;
+        return;
+    }
+    else
+    {
+        const size_t num_threads = ParallelWorkerCount(count);
+        if (num_threads < 2)
+        {
+            std::destroy_n(first, count);
+            return;
+        }
+
+        const size_t chunk = (count + num_threads - 1) / num_threads;
+        auto workers = std::make_unique<std::thread[]>(num_threads);
+
+        for (size_t t = 0; t < num_threads; ++t)
+        {
+            const size_t from = t * chunk;
+            const size_t to = std::min(count, from + chunk);
+            workers[t] = std::thread([first, from, to]
+            {
+                std::destroy_n(first + from, to - from);
+            });
+        }
+
+        for (size_t t = 0; t < num_threads; ++t)
+            workers[t].join();
+    }
+}
+
+// Политика роста ёмкости по умолчанию: удвоение, как у классического вектора
+struct DoubleGrowth
+{
+    static constexpr size_t Next(size_t capacity) noexcept
+    {
+        return capacity == 0 ? 1 : 2 * capacity;
+    }
+};
+
+// Рост в полтора раза: меньше пиковый расход памяти при реаллокации
+// ценой чуть более частых переездов
+struct OneAndHalfGrowth
+{
+    static constexpr size_t Next(size_t capacity) noexcept
+    {
+        return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+    }
+};
+
+template <typename T, typename Alloc = NewDeleteAllocator<T>, typename Growth = DoubleGrowth>
 class Vector
 {
 public:
     using iterator = T*;
     using const_iterator = const T*;
 
-    Vector() noexcept = default;
+    constexpr Vector() noexcept = default;
+
+    // Для аллокаторов с состоянием (арена, пул), у которых нет
+    // конструктора по умолчанию
+    constexpr explicit Vector(const Alloc& alloc) noexcept
+        : data_(alloc)
+    {
+    }
+
+    constexpr explicit Vector(size_t size, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
+        , size_(size)
+    {
+        ValueConstructRange(data_.GetAddress(), size);
+    }
 
-    explicit Vector(size_t size)
-        : data_(size)
+    // Конструирование большого вектора с разбиением работы между потоками.
+    // При исключении ничего не остаётся сконструированным, буфер освобождается
+    Vector(size_t size, std::execution::parallel_policy, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
         , size_(size)
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        ParallelValueConstruct(data_.GetAddress(), size);
     }
 
-    Vector(const Vector& other)
-        : data_(other.size_)
+    constexpr Vector(const Vector& other)
+        : data_(other.size_, other.data_.GetAllocator())
         , size_(other.size_)
     {
-        std::uninitialized_copy_n(other.data_.GetAddress(), size_, data_.GetAddress());
+        UninitializedCopyRange(other.data_.GetAddress(), size_, data_.GetAddress());
     }
 
-    Vector(Vector&& other) noexcept
+    constexpr Vector(Vector&& other) noexcept
         : data_(std::move(other.data_))
         , size_(std::exchange(other.size_, 0))
     {
     }
 
-    Vector& operator=(const Vector& rhs)
+    constexpr Vector& operator=(const Vector& rhs)
     {
         if (this == &rhs)
             return *this;
@@ -144,7 +671,7 @@ public:
                 data_[i] = rhs[i];
 
             if (size_ < rhs.Size())
-                std::uninitialized_copy_n(rhs.data_ + i, rhs.Size() - i, data_ + i);
+                UninitializedCopyRange(rhs.data_ + i, rhs.Size() - i, data_ + i);
             else // если у другого вектора было больше инициализированных элементов
                 std::destroy_n(data_ + rhs.Size(), size_ - rhs.Size());
 
@@ -154,7 +681,7 @@ public:
         return *this;
     }
 
-    Vector& operator=(Vector&& rhs) noexcept
+    constexpr Vector& operator=(Vector&& rhs) noexcept
     {
         if (this != &rhs)
             Swap(rhs);
@@ -162,144 +689,323 @@ public:
         return *this;
     }
 
-    const T& operator[](size_t index) const noexcept
+    VECTOR_ALWAYS_INLINE constexpr const T& operator[](size_t index) const noexcept
     {
-        return const_cast<Vector&>(*this)[index];
+        VECTOR_VERIFY(index < size_);
+        return data_[index];
     }
 
-    T& operator[](size_t index) noexcept
+    VECTOR_ALWAYS_INLINE constexpr T& operator[](size_t index) noexcept
     {
-        assert(index < size_);
+        VECTOR_VERIFY(index < size_);
         return data_[index];
     }
 
-    ~Vector()
+    // Доступ с обязательной проверкой границы независимо от режима
+    // сборки — для входных индексов, которым нельзя доверять
+    constexpr const T& At(size_t index) const
+    {
+        if (index >= size_)
+            throw std::out_of_range("Vector::At: индекс вне диапазона");
+        return data_[index];
+    }
+
+    constexpr T& At(size_t index)
+    {
+        if (index >= size_)
+            throw std::out_of_range("Vector::At: индекс вне диапазона");
+        return data_[index];
+    }
+
+    // Голый указатель на данные без каких-либо проверок; гарантированно
+    // сворачивается в одиночный load даже там, где inliner осторожничает
+    VECTOR_ALWAYS_INLINE constexpr T* Data() noexcept
+    {
+        return data_.GetAddress();
+    }
+
+    VECTOR_ALWAYS_INLINE constexpr const T* Data() const noexcept
+    {
+        return data_.GetAddress();
+    }
+
+    constexpr ~Vector()
     {
         std::destroy_n(data_.GetAddress(), size_);
     }
 
-    iterator begin() noexcept { return data_.GetAddress(); }
-    iterator end() noexcept {return (size_ != 0) ? &data_[size_] : begin(); }
+    constexpr iterator begin() noexcept { return data_.GetAddress(); }
+    constexpr iterator end() noexcept {return (size_ != 0) ? &data_[size_] : begin(); }
+
+    constexpr const_iterator begin() const noexcept { return data_.GetAddress(); }
+    constexpr const_iterator end() const noexcept { return (size_) ? &data_[size_] : begin(); }
+
+    constexpr const_iterator cbegin() const noexcept { return data_.GetAddress(); }
+    constexpr const_iterator cend() const noexcept { return (size_) ? &data_[size_] : begin(); }
+
+    // Невладеющий срез содержимого; живёт не дольше следующей реаллокации
+    constexpr Span<T> View() noexcept
+    {
+        return Span<T>(data_.GetAddress(), size_);
+    }
+
+    constexpr Span<const T> View() const noexcept
+    {
+        return Span<const T>(data_.GetAddress(), size_);
+    }
+
+    // Размер блока ForEachChunk по умолчанию — страница: блок заведомо
+    // умещается в L1, а планировщику достаётся разумная гранула работы
+    static constexpr size_t DEFAULT_CHUNK_BYTES = 4096;
+
+    // Блочная итерация: callback получает непрерывные срезы буфера
+    // по block_bytes байт (последний — короче). Внутри среза компилятор
+    // видит плотный цикл без внешних вызовов и спокойно его
+    // векторизует, а данные блока не вылетают из L1 между проходами
+    template <typename Callback>
+    constexpr void ForEachChunk(Callback&& callback, size_t block_bytes = DEFAULT_CHUNK_BYTES)
+    {
+        ForEachChunk(0, size_, std::forward<Callback>(callback), block_bytes);
+    }
+
+    template <typename Callback>
+    constexpr void ForEachChunk(Callback&& callback, size_t block_bytes = DEFAULT_CHUNK_BYTES) const
+    {
+        ForEachChunk(0, size_, std::forward<Callback>(callback), block_bytes);
+    }
 
-    const_iterator begin() const noexcept { return data_.GetAddress(); }
-    const_iterator end() const noexcept { return (size_) ? &data_[size_] : begin(); }
+    // Вариант по диапазону индексов [from, to): внешний планировщик
+    // режет вектор на партиции и раздаёт их ядрам, каждое ядро
+    // обходит свою партицию теми же блоками
+    template <typename Callback>
+    constexpr void ForEachChunk(size_t from, size_t to, Callback&& callback,
+                                size_t block_bytes = DEFAULT_CHUNK_BYTES)
+    {
+        assert(from <= to && to <= size_);
+        const size_t block = std::max<size_t>(block_bytes / sizeof(T), 1);
+        for (size_t i = from; i < to; i += block)
+            callback(Span<T>(data_.GetAddress() + i, std::min(block, to - i)));
+    }
 
-    const_iterator cbegin() const noexcept { return data_.GetAddress(); }
-    const_iterator cend() const noexcept { return (size_) ? &data_[size_] : begin(); }
+    template <typename Callback>
+    constexpr void ForEachChunk(size_t from, size_t to, Callback&& callback,
+                                size_t block_bytes = DEFAULT_CHUNK_BYTES) const
+    {
+        assert(from <= to && to <= size_);
+        const size_t block = std::max<size_t>(block_bytes / sizeof(T), 1);
+        for (size_t i = from; i < to; i += block)
+            callback(Span<const T>(data_.GetAddress() + i, std::min(block, to - i)));
+    }
 
-    size_t Size() const noexcept
+    constexpr size_t Size() const noexcept
     {
         return size_;
     }
 
-    size_t Capacity() const noexcept
+    constexpr size_t Capacity() const noexcept
     {
         return data_.Capacity();
     }
 
-    bool Empty() const noexcept
+    constexpr bool Empty() const noexcept
     {
         return size_ == 0;
     }
 
-    void Reserve(size_t new_capacity)
+    constexpr void Reserve(size_t new_capacity)
     {
         if (new_capacity <= data_.Capacity())
             return;
 
-        RawMemory<T> new_data(new_capacity);
+        // Релоцируемые элементы + realloc-аллокатор: блок достраивается
+        // на месте, рост большого буфера часто не копирует ни байта
+        if constexpr (IsTriviallyRelocatable_v<T> && ReallocatingAllocator<Alloc, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const size_t old_capacity = data_.Capacity();
+                data_.Reallocate(new_capacity);
+                NotifyReallocation<T>(old_capacity, new_capacity, 0);
+                return;
+            }
+        }
+
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator());
 
-        CopyDataRange(data_.GetAddress(), size_, new_data.GetAddress());
+        RelocateDataRange(data_.GetAddress(), size_, new_data.GetAddress());
 
         data_.Swap(new_data);
-        std::destroy_n(new_data.GetAddress(), new_data.Capacity());
+        NotifyReallocation<T>(new_data.Capacity(), data_.Capacity(), size_);
     }
 
-    void Resize(size_t new_size)
+    constexpr void Resize(size_t new_size)
     {
-        if (new_size >= Capacity())
+        if (new_size > size_)
         {
             Reserve(new_size);
-            std::uninitialized_value_construct_n(data_ + size_, new_size - size_);
+            ValueConstructRange(data_ + size_, new_size - size_);
         }
         else
         {
             for (size_t i = new_size; i < size_; i++)
-                data_[i].~T();
+                std::destroy_at(data_ + i);
+        }
+        size_ = new_size;
+    }
+
+    // Вариант Resize, распределяющий конструирование и разрушение элементов
+    // между потоками; на небольших объёмах откатывается к однопоточному пути
+    void Resize(size_t new_size, std::execution::parallel_policy)
+    {
+        if (new_size > size_)
+        {
+            Reserve(new_size);
+            ParallelValueConstruct(data_ + size_, new_size - size_);
         }
+        else
+        {
+            ParallelDestroy(data_ + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
+
+    // Меняет размер, не инициализируя новые элементы, — для буферов
+    // ввода-вывода, содержимое которых тут же перезаписывается из recv/pread.
+    // В отличие от Resize не тратит пропускную способность памяти на
+    // зануление; допустим только для тривиальных типов
+    void ResizeForOverwrite(size_t new_size)
+    {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                      "ResizeForOverwrite допустим только для тривиальных T");
+
+        Reserve(new_size);
         size_ = new_size;
     }
 
+    // Ужимает буфер до текущего размера, возвращая неиспользуемую ёмкость
+    // после Resize вниз или серии PopBack. При size_ == 0 буфер освобождается
+    constexpr void ShrinkToFit()
+    {
+        if (data_.Capacity() == size_)
+            return;
+
+        RawMemory<T, Alloc> new_data(size_, data_.GetAllocator());
+
+        RelocateDataRange(data_.GetAddress(), size_, new_data.GetAddress());
+
+        data_.Swap(new_data);
+        NotifyReallocation<T>(new_data.Capacity(), data_.Capacity(), size_);
+    }
+
     template <class Value>
-    void PushBack(Value&& value)
+    constexpr void PushBack(Value&& value)
     {
         EmplaceBack(std::forward<Value>(value));
     }
 
-    void PopBack() noexcept
+    constexpr void PopBack() noexcept
     {
         if (!Empty())
-            data_[--size_].~T();
+            std::destroy_at(data_.GetAddress() + --size_);
     }
 
     template <typename... Args>
-    T& EmplaceBack(Args&&... args)
+    constexpr T& EmplaceBack(Args&&... args)
     {
         if (size_ == Capacity())
         {
-            RawMemory<T> new_data((Capacity() == 0) ? 1 : 2 * Capacity());
-            new (new_data.GetAddress() + size_) T(std::forward<Args>(args)...);
+            RawMemory<T, Alloc> new_data(Growth::Next(Capacity()), data_.GetAllocator());
+            std::construct_at(new_data.GetAddress() + size_, std::forward<Args>(args)...);
 
-            // constexpr оператор if будет вычислен во время компиляции
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
-                std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-            else
-                std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+            RelocateDataRange(data_.GetAddress(), size_, new_data.GetAddress());
 
             data_.Swap(new_data);
-            std::destroy_n(new_data.GetAddress(), new_data.Capacity());
+            NotifyReallocation<T>(new_data.Capacity(), data_.Capacity(), size_);
             ++size_;
         }
         else
         {
-            new (data_.GetAddress() + size_)  T(std::forward<Args>(args)...);
+            std::construct_at(data_.GetAddress() + size_, std::forward<Args>(args)...);
             ++size_;
         }
 
         return data_[size_ - 1];
     }
 
+    // Вставка в конец без ветки роста: вызывающий обязан заранее обеспечить
+    // ёмкость через Reserve. Сводится к placement new и инкременту размера
+    template <typename... Args>
+    constexpr T& UncheckedEmplaceBack(Args&&... args)
+    {
+        assert(size_ < Capacity());
+        std::construct_at(data_.GetAddress() + size_, std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    // Вставка в конец без реаллокации: возвращает false, если ёмкость
+    // исчерпана, вместо того чтобы растить буфер
+    template <class Value>
+    constexpr bool TryPushBack(Value&& value) noexcept(std::is_nothrow_constructible_v<T, Value&&>)
+    {
+        if (size_ == Capacity())
+            return false;
+
+        std::construct_at(data_.GetAddress() + size_, std::forward<Value>(value));
+        ++size_;
+        return true;
+    }
+
     template <typename... Args>
-    iterator Emplace(const_iterator pos, Args&&... args)
+    constexpr iterator Emplace(const_iterator pos, Args&&... args)
     {
         size_t value_pos = pos - begin();
 
         if (size_ == Capacity())
         {
             // Создаём новую область памяти
-            RawMemory<T> new_data((Capacity() == 0) ? 1 : 2 * Capacity());
+            RawMemory<T, Alloc> new_data(Growth::Next(Capacity()), data_.GetAllocator());
 
             // Вставляем элемент в новую область
-            new (new_data.GetAddress() + value_pos) T(std::forward<Args>(args)...);
-
-            // Добавляем значения до pos в новую область памяти
-            CopyDataRange(data_.GetAddress(), value_pos, new_data.GetAddress());
-
-            // Добавляем значения от pos до end в новую область памяти
-            CopyDataRange(data_.GetAddress() + value_pos, size_ - value_pos, new_data.GetAddress() + value_pos + 1);
-
-            data_.Swap(new_data);
-            std::destroy_n(new_data.GetAddress(), new_data.Capacity());
+            std::construct_at(new_data.GetAddress() + value_pos, std::forward<Args>(args)...);
+
+            if constexpr (IsTriviallyRelocatable_v<T>)
+            {
+                // memcpy не бросает — источник можно освобождать посегментно
+                RelocateDataRange(data_.GetAddress(), value_pos, new_data.GetAddress());
+                RelocateDataRange(data_.GetAddress() + value_pos, size_ - value_pos, new_data.GetAddress() + value_pos + 1);
+                data_.Swap(new_data);
+            }
+            else
+            {
+                // Перенос в два сегмента: старый буфер обязан остаться целым
+                // до конца второго — если копия в хвосте бросит, вектор
+                // не потеряет ни одного элемента. Разрушение источника
+                // поэтому откладывается до момента после обмена буферов
+                CopyDataRange(data_.GetAddress(), value_pos, new_data.GetAddress());
+                CopyDataRange(data_.GetAddress() + value_pos, size_ - value_pos, new_data.GetAddress() + value_pos + 1);
+                data_.Swap(new_data);
+                std::destroy_n(new_data.GetAddress(), size_);
+            }
+            NotifyReallocation<T>(new_data.Capacity(), data_.Capacity(), size_);
         }
         else if (pos == end())
         {
-            new(end()) T(std::forward<Args>(args)...);
+            std::construct_at(end(), std::forward<Args>(args)...);
         }
         else
         {
-            new(end()) T(std::forward<T>(*(end() - 1)));
-            std::move_backward(&data_[value_pos], end() - 1, end());
-            data_[value_pos] = T(std::forward<Args>(args)...);
+            // Значение строится до сдвига: args могут ссылаться на сдвигаемый элемент
+            T tmp(std::forward<Args>(args)...);
+            if (!std::is_constant_evaluated() && std::is_trivially_copyable_v<T>)
+            {
+                ShiftDataRange(data_ + value_pos, size_ - value_pos, data_ + value_pos + 1);
+            }
+            else
+            {
+                std::construct_at(end(), std::forward<T>(*(end() - 1)));
+                std::move_backward(&data_[value_pos], end() - 1, end());
+            }
+            data_[value_pos] = std::move(tmp);
         }
 
         ++size_;
@@ -307,37 +1013,368 @@ public:
     }
 
     template <class Value>
-    iterator Insert(const_iterator pos, Value&& value)
+    constexpr iterator Insert(const_iterator pos, Value&& value)
     {
         return Emplace(pos, std::forward<Value>(value));
     }
 
-    iterator Erase(const_iterator pos) noexcept
+    // Добавляет в конец все элементы [first, last) с не более чем одной
+    // реаллокацией вместо серии реаллокаций от поэлементного PushBack.
+    // Для перемещения элементов оборачивайте итераторы в std::make_move_iterator.
+    // Сырые указатели в собственный буфер (v.AppendRange(v.begin(), v.end()),
+    // срез из View()) распознаются и переживают реаллокацию; обёрнутые
+    // итераторы в собственный буфер — предусловие вызывающего
+    template <typename InputIt>
+    constexpr void AppendRange(InputIt first, InputIt last)
+    {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0)
+            return;
+
+        if constexpr (std::is_convertible_v<InputIt, const T*>)
+        {
+            // Самодобавление: Reserve инвалидирует first/last, поэтому
+            // источник запоминается индексом и перечитывается после роста
+            if (!std::is_constant_evaluated() && AliasesStorage(first))
+            {
+                const size_t from = static_cast<size_t>(static_cast<const T*>(first) - data_.GetAddress());
+                if (Capacity() < size_ + count)
+                    Reserve(std::max(size_ + count, Growth::Next(Capacity())));
+
+                UninitializedCopyRange(data_ + from, count, data_ + size_);
+                size_ += count;
+                return;
+            }
+        }
+
+        if (Capacity() < size_ + count)
+            Reserve(std::max(size_ + count, Growth::Next(Capacity())));
+
+        UninitializedCopyRange(first, count, data_ + size_);
+        size_ += count;
+    }
+
+    constexpr void AppendRange(Span<const T> values)
+    {
+        AppendRange(values.begin(), values.end());
+    }
+
+    // Вставляет все элементы [first, last) перед pos, сдвигая хвост один раз.
+    // Сырые указатели в собственный буфер допустимы — партия снимается
+    // во временный буфер до сдвигов; обёрнутые итераторы в собственный
+    // буфер — предусловие вызывающего
+    template <typename InputIt>
+    constexpr iterator InsertRange(const_iterator pos, InputIt first, InputIt last)
+    {
+        size_t value_pos = pos - begin();
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0)
+            return begin() + value_pos;
+
+        if constexpr (std::is_convertible_v<InputIt, const T*>)
+        {
+            // Самовставка: и реаллокация, и сдвиг хвоста затирают источник,
+            // поэтому партия копируется в независимый буфер, а дальше
+            // работает обычный путь с перемещением из копии
+            if (!std::is_constant_evaluated() && AliasesStorage(first))
+            {
+                Vector staged(data_.GetAllocator());
+                staged.AppendRange(static_cast<const T*>(first), static_cast<const T*>(last));
+                return InsertRange(begin() + value_pos,
+                                   std::make_move_iterator(staged.begin()),
+                                   std::make_move_iterator(staged.end()));
+            }
+        }
+
+        if (Capacity() < size_ + count)
+        {
+            RawMemory<T, Alloc> new_data(std::max(size_ + count, Growth::Next(Capacity())), data_.GetAllocator());
+
+            // Вставляемый диапазон копируется первым: при исключении терять нечего
+            UninitializedCopyRange(first, count, new_data.GetAddress() + value_pos);
+
+            if constexpr (IsTriviallyRelocatable_v<T>)
+            {
+                RelocateDataRange(data_.GetAddress(), value_pos, new_data.GetAddress());
+                RelocateDataRange(data_.GetAddress() + value_pos, size_ - value_pos,
+                                  new_data.GetAddress() + value_pos + count);
+                data_.Swap(new_data);
+            }
+            else
+            {
+                // Как в Emplace: старый буфер не трогается, пока оба сегмента
+                // не перенесены, иначе исключение из второго оставило бы
+                // вектор с уже разрушенным префиксом
+                CopyDataRange(data_.GetAddress(), value_pos, new_data.GetAddress());
+                CopyDataRange(data_.GetAddress() + value_pos, size_ - value_pos,
+                              new_data.GetAddress() + value_pos + count);
+                data_.Swap(new_data);
+                std::destroy_n(new_data.GetAddress(), size_);
+            }
+            NotifyReallocation<T>(new_data.Capacity(), data_.Capacity(), size_);
+        }
+        else
+        {
+            const size_t tail = size_ - value_pos;
+            if (count < tail)
+            {
+                // Последние count элементов хвоста переезжают в сырую память,
+                // остальной хвост сдвигается внутри инициализированной области
+                CopyDataRange(data_ + (size_ - count), count, data_ + size_);
+                ShiftDataRange(data_ + value_pos, tail - count, data_ + value_pos + count);
+                std::copy(first, last, data_ + value_pos);
+            }
+            else
+            {
+                CopyDataRange(data_ + value_pos, tail, data_ + value_pos + count);
+                InputIt mid = std::next(first, tail);
+                std::copy(first, mid, data_ + value_pos);
+                UninitializedCopyRange(mid, count - tail, data_ + size_);
+            }
+        }
+
+        size_ += count;
+        return begin() + value_pos;
+    }
+
+    constexpr iterator InsertRange(const_iterator pos, Span<const T> values)
+    {
+        return InsertRange(pos, values.begin(), values.end());
+    }
+
+    constexpr iterator Erase(const_iterator pos) noexcept
     {
         assert(!Empty());
         size_t value_pos = pos - begin();
-        std::move(&data_[value_pos + 1], end(), &data_[value_pos]);
+        ShiftDataRange(data_ + value_pos + 1, size_ - value_pos - 1, data_ + value_pos);
         PopBack();
         return &data_[value_pos];
     }
 
-    void Swap(Vector& other) noexcept
+    // Удаляет диапазон [first, last) одним сдвигом хвоста вместо
+    // поэлементных вызовов Erase
+    constexpr iterator Erase(const_iterator first, const_iterator last) noexcept
+    {
+        const size_t from = first - begin();
+        const size_t count = last - first;
+        if (count == 0)
+            return begin() + from;
+
+        ShiftDataRange(data_ + from + count, size_ - from - count, data_ + from);
+        std::destroy_n(data_ + (size_ - count), count);
+        size_ -= count;
+        return begin() + from;
+    }
+
+    // Удаляет все элементы, удовлетворяющие предикату, одним проходом
+    // с уплотнением на месте; возвращает число удалённых
+    template <typename Pred>
+    constexpr size_t RemoveIf(Pred pred)
+    {
+        iterator new_end = std::remove_if(begin(), end(), pred);
+        const size_t removed = end() - new_end;
+        std::destroy_n(new_end, removed);
+        size_ -= removed;
+        return removed;
+    }
+
+    // Удаление без сохранения порядка: в дыру переезжает последний элемент.
+    // O(1) вместо O(N) сдвига хвоста
+    constexpr iterator UnorderedErase(const_iterator pos) noexcept
+    {
+        assert(!Empty());
+        const size_t value_pos = pos - begin();
+        if (value_pos != size_ - 1)
+            data_[value_pos] = std::move(data_[size_ - 1]);
+        PopBack();
+        return begin() + value_pos;
+    }
+
+    // Разрушает элементы, сохраняя ёмкость
+    constexpr void Clear() noexcept
+    {
+        std::destroy_n(data_.GetAddress(), size_);
+        size_ = 0;
+    }
+
+    // Отложенный снос для критичных к латентности путей: буфер вместе
+    // с числом элементов уезжает в фоновую очередь утилизации, и горячий
+    // поток возвращается за O(1) вместо синхронного destroy_n по ста
+    // миллионам элементов. Вектор остаётся пустым с нулевой ёмкостью
+    void ClearDeferred()
+    {
+        if (Capacity() == 0)
+        {
+            size_ = 0;
+            return;
+        }
+
+        DeferredReclaimer::Instance().Defer(
+            [buffer = std::move(data_), count = size_]() mutable
+            {
+                std::destroy_n(buffer.GetAddress(), count);
+            });
+        size_ = 0;
+    }
+
+    constexpr void Swap(Vector& other) noexcept
     {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
     }
 
-private:
-    constexpr void CopyDataRange(T* source, size_t count, T* dest)
+    // Массовые алгоритмы поверх непрерывного буфера. Делегируют
+    // векторизованным ядрам из simd_algorithms.h — те используют явные
+    // SIMD-варианты, когда они доступны для T на целевой платформе
+
+    void Fill(const T& value)
+    {
+        SimdFill(data_.GetAddress(), size_, value);
+    }
+
+    iterator Find(const T& value) noexcept
+    {
+        return begin() + SimdFind(data_.GetAddress(), size_, value);
+    }
+
+    const_iterator Find(const T& value) const noexcept
+    {
+        return begin() + SimdFind(data_.GetAddress(), size_, value);
+    }
+
+    T Sum() const noexcept requires std::is_arithmetic_v<T>
+    {
+        return SimdSum(data_.GetAddress(), size_);
+    }
+
+    // Минимум и максимум за один проход; вектор не должен быть пустым
+    std::pair<T, T> MinMax() const noexcept requires std::is_arithmetic_v<T>
+    {
+        assert(!Empty());
+        return SimdMinMax(data_.GetAddress(), size_);
+    }
+
+    template <typename Pred>
+    size_t CountIf(Pred pred) const
+    {
+        return SimdCountIf(data_.GetAddress(), size_, pred);
+    }
+
+    // Сравнение содержимого; для тривиально сравнимых T — один memcmp
+    // по всему буферу вместо поэлементного цикла
+    constexpr bool operator==(const Vector& rhs) const
+    {
+        if (size_ != rhs.size_)
+            return false;
+
+        if constexpr (std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>)
+        {
+            if (!std::is_constant_evaluated())
+                return size_ == 0
+                    || std::memcmp(data_.GetAddress(), rhs.data_.GetAddress(), size_ * sizeof(T)) == 0;
+        }
+        return std::equal(begin(), end(), rhs.begin());
+    }
+
+    constexpr auto operator<=>(const Vector& rhs) const
+    {
+        // Для байтовых беззнаковых типов лексикографический порядок
+        // совпадает с порядком memcmp
+        if constexpr (sizeof(T) == 1 && std::is_integral_v<T> && std::is_unsigned_v<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const size_t common = std::min(size_, rhs.size_);
+                const int verdict = common == 0
+                    ? 0 : std::memcmp(data_.GetAddress(), rhs.data_.GetAddress(), common);
+                if (verdict != 0)
+                    return verdict < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+                return size_ <=> rhs.size_;
+            }
+        }
+        return std::lexicographical_compare_three_way(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    // Хеш содержимого. Типы с уникальным объектным представлением
+    // хешируются одним проходом HashBytes по сырому буферу; остальные —
+    // поэлементной комбинацией std::hash
+    size_t Hash() const
     {
-        // constexpr оператор if будет вычислен во время компиляции
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
-            std::uninitialized_move_n(source, count, dest);
+        if constexpr (std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>)
+        {
+            return HashBytes(data_.GetAddress(), size_ * sizeof(T));
+        }
         else
-            std::uninitialized_copy_n(source, count, dest);
+        {
+            size_t seed = size_;
+            for (const T& value : *this)
+                seed = RotateLeft64(seed, 5) * HASH_PRIME_1 + std::hash<T>{}(value);
+            return seed;
+        }
+    }
+
+    // Бинарная сериализация: компактный заголовок (число элементов, ширина
+    // элемента, порядок байтов) и содержимое буфера одной непрерывной
+    // записью — вместо поэлементного цикла через форматированный вывод
+    void WriteTo(std::ostream& sink) const requires std::is_trivially_copyable_v<T>
+    {
+        const uint64_t count = size_;
+        const uint32_t element_size = sizeof(T);
+        const uint8_t endianness = NativeEndiannessTag();
+
+        sink.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        sink.write(reinterpret_cast<const char*>(&element_size), sizeof(element_size));
+        sink.write(reinterpret_cast<const char*>(&endianness), sizeof(endianness));
+
+        if (size_ != 0)
+            sink.write(reinterpret_cast<const char*>(data_.GetAddress()), size_ * sizeof(T));
+
+        if (!sink)
+            throw std::runtime_error("Vector::WriteTo: запись в поток не удалась");
+    }
+
+    // Чтение обратно: одна аллокация без зануления и одно массовое чтение.
+    // Несовпадение ширины элемента или порядка байтов — ошибка формата
+    static Vector ReadFrom(std::istream& source) requires std::is_trivially_copyable_v<T>
+    {
+        uint64_t count = 0;
+        uint32_t element_size = 0;
+        uint8_t endianness = 0;
+
+        source.read(reinterpret_cast<char*>(&count), sizeof(count));
+        source.read(reinterpret_cast<char*>(&element_size), sizeof(element_size));
+        source.read(reinterpret_cast<char*>(&endianness), sizeof(endianness));
+
+        if (!source)
+            throw std::runtime_error("Vector::ReadFrom: не удалось прочитать заголовок");
+        if (element_size != sizeof(T))
+            throw std::runtime_error("Vector::ReadFrom: ширина элемента не совпадает");
+        if (endianness != NativeEndiannessTag())
+            throw std::runtime_error("Vector::ReadFrom: порядок байтов не совпадает");
+
+        Vector result;
+        result.ResizeForOverwrite(count);
+        if (count != 0)
+        {
+            source.read(reinterpret_cast<char*>(result.data_.GetAddress()),
+                        count * sizeof(T));
+            if (!source)
+                throw std::runtime_error("Vector::ReadFrom: содержимое короче заявленного");
+        }
+        return result;
+    }
+
+private:
+    // true, если p указывает внутрь текущего буфера — признак того,
+    // что вызывающий передал диапазон из самого вектора. Функторы
+    // сравнения дают тотальный порядок и для несвязанных указателей
+    bool AliasesStorage(const T* p) const noexcept
+    {
+        return std::greater_equal<const T*>{}(p, data_.GetAddress())
+            && std::less<const T*>{}(p, data_.GetAddress() + Capacity());
     }
 
 private:
-    RawMemory<T> data_;
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
 };
\ No newline at end of file